@@ -1,4 +1,12 @@
 #pragma once
 namespace engine::config {
 constexpr bool handleMultiplicity = true;
+/// Scan strings that are only needed for the output as row ids and resolve them in the output
+constexpr bool lateMaterialization = true;
+/// Replay the pipelines chosen for earlier queries of the same shape instead of optimizing again
+constexpr bool planCache = true;
+/// Run small build pipelines that are independent of each other concurrently, each one on a single worker
+constexpr bool concurrentPipelines = true;
+/// Suspend build pipelines that produce far more tuples than estimated and optimize the query again
+constexpr bool reoptimize = true;
 }
\ No newline at end of file
@@ -1,8 +1,11 @@
+#include "Execute.hpp"
 #include "infra/PageMemory.hpp"
 #include "infra/QueryMemory.hpp"
 #include "infra/Scheduler.hpp"
+#include "query/CostModel.hpp"
 #include "query/PlanImport.hpp"
 #include "query/QueryPlan.hpp"
+#include "query/SharedBuilds.hpp"
 #include <plan.h>
 #include <unistd.h>
 //---------------------------------------------------------------------------
@@ -21,6 +24,48 @@ ColumnarTable execute(QueryPlan plan, [[maybe_unused]] void* context) {
     return std::move(output);
 }
 //---------------------------------------------------------------------------
+void execute(QueryPlan plan, ResultSink sink, [[maybe_unused]] void* context) {
+    Scheduler::start_query();
+    pagememory::start_query();
+    {
+        QueryPlan pp = std::move(plan);
+        pp.run(sink);
+    }
+    querymemory::end_query();
+    Scheduler::end_query();
+}
+//---------------------------------------------------------------------------
+void execute(const Plan& plan, ResultSink sink, [[maybe_unused]] void* context) {
+    Scheduler::start_query();
+    pagememory::start_query();
+    {
+        DataSource ds;
+        auto imported = PlanImport::importPlan(ds, plan);
+        imported.run(sink);
+    }
+    querymemory::end_query();
+    Scheduler::end_query();
+}
+//---------------------------------------------------------------------------
+std::vector<ColumnarTable> execute(std::vector<QueryPlan> plans, [[maybe_unused]] void* context) {
+    Scheduler::start_query();
+    pagememory::start_query();
+    std::vector<ColumnarTable> output;
+    output.reserve(plans.size());
+    {
+        // The shared hash tables live until the whole batch is done
+        SharedBuilds sharedBuilds;
+        for (auto& plan : plans) {
+            plan.setSharedBuilds(&sharedBuilds);
+            output.push_back(plan.run());
+        }
+        plans.clear();
+    }
+    querymemory::end_query();
+    Scheduler::end_query();
+    return output;
+}
+//---------------------------------------------------------------------------
 }
 //---------------------------------------------------------------------------
 namespace Contest {
@@ -41,6 +86,10 @@ ColumnarTable execute(const Plan& plan, [[maybe_unused]] void* context) {
 //---------------------------------------------------------------------------
 void* build_context() {
     engine::Scheduler::setup();
+    // Use the costs that were calibrated on this machine, if any
+    engine::CostModel model;
+    if (model.load(engine::CostModel::defaultFile))
+        engine::CostModel::set(model);
 
     return nullptr;
 }
@@ -1,5 +1,7 @@
 #pragma once
 //---------------------------------------------------------------------------
+#include "query/ResultSink.hpp"
+#include <vector>
 #include <plan.h>
 //---------------------------------------------------------------------------
 namespace engine {
@@ -7,6 +9,12 @@ namespace engine {
 class QueryPlan;
 //---------------------------------------------------------------------------
 ColumnarTable execute(QueryPlan plan, [[maybe_unused]] void* context);
+/// Execute a query and stream the result to the sink instead of materializing it
+void execute(QueryPlan plan, ResultSink sink, [[maybe_unused]] void* context);
+/// Execute a query and stream the result to the sink instead of materializing it
+void execute(const Plan& plan, ResultSink sink, [[maybe_unused]] void* context);
+/// Execute a batch of queries on the same data. Hash tables that several queries build from the same base table are built once
+std::vector<ColumnarTable> execute(std::vector<QueryPlan> plans, [[maybe_unused]] void* context);
 //---------------------------------------------------------------------------
 }
-//---------------------------------------------------------------------------
\ No newline at end of file
+//---------------------------------------------------------------------------
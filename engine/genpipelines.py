@@ -13,6 +13,7 @@ def subsets_with_replacement(p, r):
             yield v
 
 targets = [
+    "engine::DistinctTarget",
     "engine::HashtableBuild",
     "engine::TableTarget"
 ]
@@ -35,7 +36,7 @@ for i in range(0, maxn):
         if not isValid:
             continue
 
-        for target in ["engine::TableTarget"]:
+        for target in ["engine::DistinctTarget", "engine::TableTarget"]:
             for scan in scans:
                 attrs = []
                 restAttrs = []
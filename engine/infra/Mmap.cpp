@@ -13,6 +13,15 @@ void Mmap::prefault(void* data, size_t size) {
         mem[i] = 0;
 }
 //---------------------------------------------------------------------------
+void Mmap::willNeed(const void* data, size_t size) {
+    if (!size)
+        return;
+    // madvise requires a page aligned start
+    auto begin = reinterpret_cast<uintptr_t>(data) & ~static_cast<uintptr_t>(4095);
+    auto end = reinterpret_cast<uintptr_t>(data) + size;
+    madvise(reinterpret_cast<void*>(begin), end - begin, MADV_WILLNEED);
+}
+//---------------------------------------------------------------------------
 Mmap Mmap::mapFile(const std::string& filename) {
     Mmap result;
     result.file = open(filename.c_str(), O_RDONLY);
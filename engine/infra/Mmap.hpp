@@ -33,6 +33,8 @@ class Mmap {
     }
 
     static void prefault(void* data, size_t size);
+    /// Hint that the range will be read soon, the kernel reads it ahead asynchronously
+    static void willNeed(const void* data, size_t size);
 
 
     static Mmap mapFile(const std::string& fileName);
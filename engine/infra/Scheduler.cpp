@@ -67,6 +67,7 @@ DeadTask deadTask;
 }
 //---------------------------------------------------------------------------
 __thread size_t Scheduler::currentWorker = 0;
+__thread bool Scheduler::inlineTasks = false;
 //---------------------------------------------------------------------------
 struct Scheduler::Worker {
     std::atomic<bool> sleeping{true};
@@ -191,6 +192,20 @@ struct alignas(hardwareCachelineSize) JobState {
 //---------------------------------------------------------------------------
 /// Run a parallel morsel task
 void Scheduler::parallelImpl(size_t size, FunctionRef<void(size_t, size_t)> task, bool finalizeTask) {
+    // Within an independent task, the other workers are busy with their own tasks
+    if (inlineTasks) {
+        for (size_t i = 0; i < size; i++) {
+            // Call initialize
+            if (i == 0 && finalizeTask)
+                task(currentWorker, ~0ull - 1);
+            task(currentWorker, i);
+        }
+        // Call finalize
+        if (size && finalizeTask)
+            task(currentWorker, ~0ull);
+        return;
+    }
+
     size_t jobs = std::clamp<size_t>(size, 1, concurrency());
 
     JobState states[jobs];
@@ -235,6 +250,15 @@ void Scheduler::parallelImpl(size_t size, FunctionRef<void(size_t, size_t)> task
     });
 }
 //---------------------------------------------------------------------------
+void Scheduler::parallelIndependentImpl(size_t size, FunctionRef<void(size_t, size_t)> task) {
+    assert(!inlineTasks);
+    parallelImpl(size, [&](size_t workerId, size_t i) {
+        inlineTasks = true;
+        task(workerId, i);
+        inlineTasks = false;
+    });
+}
+//---------------------------------------------------------------------------
 void Scheduler::Worker::operator()() {
     auto conc = concurrency();
     Random rng(id);
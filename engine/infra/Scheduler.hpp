@@ -10,6 +10,8 @@
 namespace engine {
 class Scheduler {
     static __thread size_t currentWorker;
+    /// Are we within an independent task? Then parallel tasks run on the current thread
+    static __thread bool inlineTasks;
 
     public:
     struct Worker;
@@ -57,6 +59,14 @@ class Scheduler {
         return parallelFor(begin, end, 1, std::forward<Fun>(task));
     }
 
+    /// Run independent tasks concurrently, each one on a single thread
+    static void parallelIndependentImpl(size_t size, FunctionRef<void(size_t, size_t)> task);
+    /// Run independent tasks concurrently, each one on a single thread. The parallel tasks they start run on that thread as well
+    template <typename Fun>
+    static void parallelIndependent(size_t begin, size_t end, Fun&& task) {
+        return parallelIndependentImpl(end - begin, [&task, begin](size_t workerId, size_t i) { return task(workerId, begin + i); });
+    }
+
     /// Get thread id
     static size_t threadId() noexcept { return currentWorker; }
 
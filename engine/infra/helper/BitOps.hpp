@@ -1,6 +1,8 @@
 #pragma once
 #include <bit>
+#include <cstring>
 #include <limits>
+#include <type_traits>
 //---------------------------------------------------------------------------
 namespace engine {
 //---------------------------------------------------------------------------
@@ -88,5 +90,13 @@ constexpr int countr_one(T x) noexcept {
     return countr_zero((T)~x);
 }
 //---------------------------------------------------------------------------
+template <typename To, typename From>
+inline To bit_cast(const From& from) noexcept {
+    static_assert(sizeof(To) == sizeof(From) && std::is_trivially_copyable_v<To> && std::is_trivially_copyable_v<From>);
+    To to;
+    std::memcpy(&to, &from, sizeof(To));
+    return to;
+}
+//---------------------------------------------------------------------------
 }
 //---------------------------------------------------------------------------
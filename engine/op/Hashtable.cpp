@@ -4,6 +4,7 @@
 #include "infra/helper/BitOps.hpp"
 #include "query/DataSource.hpp"
 #include "query/RuntimeValue.hpp"
+#include "storage/StringPtr.hpp"
 #include <numeric>
 #include <unordered_set>
 //---------------------------------------------------------------------------
@@ -217,11 +218,14 @@ static void finishConsumeLogic(HashtableBuild* htb, size_t partition) {
     }
     uint64_t localNumKeys = 0;
     uint64_t localRemovedTuples = 0;
+    uint64_t localMinKey = ~0ull, localMaxKey = 0;
     bool possibleDuplicate = false;
     const auto htShift = ht.shift;
     const auto htBuckets = ht.ht;
     iterateTuples(htb, partition, [&](Hashtable::Entry& tuple) {
         auto key = tuple.tuple[Hashtable::keyOffset];
+        localMinKey = std::min(localMinKey, key);
+        localMaxKey = std::max(localMaxKey, key);
         auto [h, b] = Hashtable::computeHashes(key);
         assert(h >> htb->partitionShift == partition);
         auto ind = h >> htShift;
@@ -260,6 +264,8 @@ static void finishConsumeLogic(HashtableBuild* htb, size_t partition) {
         __atomic_fetch_sub(&ht.numTuples, localRemovedTuples, __ATOMIC_SEQ_CST);
     if (possibleDuplicate)
         __atomic_store_n(&ht.isCertainlyDuplicateFree, false, __ATOMIC_SEQ_CST);
+    for (auto cur = __atomic_load_n(&ht.minKey, __ATOMIC_RELAXED); localMinKey < cur && !__atomic_compare_exchange_n(&ht.minKey, &cur, localMinKey, true, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED););
+    for (auto cur = __atomic_load_n(&ht.maxKey, __ATOMIC_RELAXED); localMaxKey > cur && !__atomic_compare_exchange_n(&ht.maxKey, &cur, localMaxKey, true, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED););
 };
 //---------------------------------------------------------------------------
 std::array<void (*)(HashtableBuild*, size_t), 16> finishConsumeLogics = ([]<size_t... Is>(std::index_sequence<Is...>) {
@@ -269,9 +275,26 @@ std::array<void (*)(HashtableBuild*, size_t), 16> finishConsumeCrossProductLogic
     return std::array<void (*)(HashtableBuild*, size_t), 16>{&finishConsumeCrossProductLogic<Is>...};
 })(std::make_index_sequence<16>{});
 //---------------------------------------------------------------------------
+void HashtableBuild::reportProgress(LocalState& ls) {
+    ls.nextReport += progressInterval;
+    if (reportedTuples.fetch_add(progressInterval) + progressInterval > suspendLimit && suspendRequest)
+        suspendRequest->store(true);
+}
+//---------------------------------------------------------------------------
+size_t HashtableBuild::getNumTuples() const {
+    size_t result = 0;
+    for (auto* current = localStateRefs.load(); current; current = current->next)
+        result += current->numTuples;
+    return result;
+}
+//---------------------------------------------------------------------------
 void HashtableBuild::finishConsume() {
     using namespace std;
 
+    // A suspended build is finished once it is resumed, its local states stay valid until then
+    if (suspendRequest && suspendRequest->load())
+        return;
+
     ht.numTuples = 0;
     size_t attrCount = 2;
     for (auto* current = localStateRefs.load(); current; current = current->next) {
@@ -294,6 +317,9 @@ void HashtableBuild::finishConsume() {
         ht.bloom[h >> ht.shift] = 0xffff;
     } else {
         ht.allocateHashtable(std::max<size_t>(ht.numTuples, numPartitions));
+        // The key range is collected while inserting the partitions
+        ht.minKey = ~0ull;
+        ht.maxKey = 0;
     }
 
     auto* logic = finishConsumeLogics[attrCount];
@@ -340,4 +366,118 @@ HashtableBuild::HashtableBuild(Hashtable& ht, size_t cardEstimate) : ht(ht) {
     partitionShift = Hashtable::hashBits - partitionCountShift;
 }
 //---------------------------------------------------------------------------
+std::string DistinctTarget::getPretty() const {
+    return "distinct";
+}
+//---------------------------------------------------------------------------
+uint64_t DistinctTarget::hashString(uint64_t value) {
+    if (value == RuntimeValue::nullValue)
+        return value;
+    // Long strings are only hashed by their first page
+    return std::hash<std::string_view>{}(StringPtr{value}.prefix());
+}
+//---------------------------------------------------------------------------
+template <size_t AttributeCount>
+[[gnu::always_inline]] static bool distinctEqual(const DistinctTarget* dt, Hashtable::Entry& t1, Hashtable::Entry& t2) {
+    if (tupleEqual<AttributeCount>(t1, t2))
+        return true;
+    // Equal strings may be stored at different locations
+    if (!dt->stringColumns || t1.tuple[Hashtable::keyOffset] != t2.tuple[Hashtable::keyOffset])
+        return false;
+    constexpr size_t valueOffset = Hashtable::keyOffset + 1;
+    for (size_t i = 0; i < AttributeCount - 1 - valueOffset; i++) {
+        auto v1 = t1.tuple[valueOffset + i];
+        auto v2 = t2.tuple[valueOffset + i];
+        if (v1 == v2)
+            continue;
+        if (!((dt->stringColumns >> i) & 1) || v1 == RuntimeValue::nullValue || v2 == RuntimeValue::nullValue)
+            return false;
+        if (!(StringPtr{v1} == StringPtr{v2}))
+            return false;
+    }
+    return true;
+}
+//---------------------------------------------------------------------------
+template <size_t AttributeCount>
+static void distinctLogic(DistinctTarget* dt, size_t partition, TableTarget::LocalState& output) {
+    auto partitionCountShift = Hashtable::hashBits - dt->build.partitionShift;
+    auto& ht = dt->ht;
+    auto size = ht.htSize() >> partitionCountShift;
+    memset(ht.ht + partition * size, 0, size * sizeof(uint64_t));
+
+    uint64_t localNumTuples = 0;
+    const auto htShift = ht.shift;
+    const auto htBuckets = ht.ht;
+    iterateTuples(&dt->build, partition, [&](Hashtable::Entry& tuple) {
+        auto key = tuple.tuple[Hashtable::keyOffset];
+        auto ind = Hashtable::computeHashes(key).first >> htShift;
+        assert(ind >= partition * size);
+        assert(ind < (partition + 1) * size);
+
+        // The chain only contains distinct tuples, so it stays short
+        auto* old = reinterpret_cast<Hashtable::Entry*>(htBuckets[ind]);
+        for (auto* current = old; current; current = current->next)
+            if (distinctEqual<AttributeCount>(dt, *current, tuple))
+                return;
+        tuple.next = old;
+        htBuckets[ind] = reinterpret_cast<uint64_t>(&tuple);
+        localNumTuples++;
+        dt->output.consumeTuple(output, 1, tuple.tuple + Hashtable::keyOffset + 1);
+    });
+
+    __atomic_fetch_add(&ht.numTuples, localNumTuples, __ATOMIC_SEQ_CST);
+}
+//---------------------------------------------------------------------------
+static std::array<void (*)(DistinctTarget*, size_t, TableTarget::LocalState&), 16> distinctLogics = ([]<size_t... Is>(std::index_sequence<Is...>) {
+    return std::array<void (*)(DistinctTarget*, size_t, TableTarget::LocalState&), 16>{&distinctLogic<Is>...};
+})(std::make_index_sequence<16>{});
+//---------------------------------------------------------------------------
+void DistinctTarget::finishConsume() {
+    size_t numTuples = 0;
+    size_t attrCount = 2;
+    for (auto* current = build.localStateRefs.load(); current; current = current->next) {
+        numTuples += current->numTuples;
+        if (current->numTuples)
+            attrCount = current->attrCount;
+    }
+
+    auto numPartitions = 1ull << (Hashtable::hashBits - build.partitionShift);
+    ht.allocateHashtable(std::max<size_t>(numTuples, numPartitions));
+    ht.numTuples = 0;
+
+    auto* logic = distinctLogics[attrCount];
+    if (numTuples <= 256 || !build.localStateRefs.load()->next) {
+        auto* state = new (querymemory::allocate(sizeof(TableTarget::LocalState))) TableTarget::LocalState(output);
+        for (size_t partition = 0; partition < numPartitions; ++partition)
+            logic(this, partition, *state);
+        output.finalize(*state);
+    } else {
+        // Every worker writes the distinct tuples of its partitions to its own output state
+        auto* states = static_cast<TableTarget::LocalState*>(querymemory::allocate(sizeof(TableTarget::LocalState) * Scheduler::concurrency()));
+        Scheduler::parallelMorsel(0, numPartitions, 1, [&](size_t workerId, size_t partition) {
+            if (partition == ~0ull - 1) {
+                new (&states[workerId]) TableTarget::LocalState(output);
+            } else if (partition == ~0ull) {
+                output.finalize(states[workerId]);
+            } else {
+                logic(this, partition, states[workerId]);
+            } }, true);
+    }
+    output.finishConsume();
+    ht.numKeys = ht.numTuples;
+
+    if constexpr (!std::is_trivially_destructible_v<HashtableBuild::LocalState>) {
+        for (auto* current = build.localStateRefs.load(); current; current = current->next)
+            current->~LocalState();
+    }
+}
+//---------------------------------------------------------------------------
+DistinctTarget::DistinctTarget(SmallVec<DataType>&& types, size_t cardEstimate) : build(ht, cardEstimate), output(std::move(types)) {
+    for (unsigned i = 0; i < output.types.size(); i++)
+        if (output.types[i] == DataType::VARCHAR)
+            stringColumns |= 1u << i;
+        else if (output.types[i] == DataType::FP64)
+            doubleColumns |= 1u << i;
+}
+//---------------------------------------------------------------------------
 }
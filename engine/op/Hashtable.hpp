@@ -3,6 +3,7 @@
 #include "Config.hpp"
 #include "infra/JoinFilter.hpp"
 #include "op/OpBase.hpp"
+#include "op/TableTarget.hpp"
 #include "op/TargetBase.hpp"
 
 #include <atomic>
@@ -54,6 +55,8 @@ class Hashtable {
     size_t numKeys = 0;
     /// Are we certainly duplicate free?
     bool isCertainlyDuplicateFree = true;
+    /// The smallest and largest key. Unbounded for cross products
+    uint64_t minKey = 0, maxKey = ~0ull;
 
     friend struct HashtableBuild;
     friend struct HashtableProbe;
@@ -110,6 +113,16 @@ class Hashtable {
     /// Filter the table with eq restrictions
     void filterEq(const EqRestriction& restrictions);
 
+    /// Iterate over the tuples with the key. The tuples start with the multiplicity if it is handled
+    template <typename CallbackT>
+    void iterateMatches(uint64_t key, CallbackT&& callback) const {
+        if (!ht)
+            return;
+        auto h = computeHashes(key).first;
+        for (const auto* current = reinterpret_cast<const Entry*>(ht[h >> shift]); current; current = current->next)
+            if (current->tuple[Hashtable::keyOffset] == key)
+                callback(current->tuple);
+    }
     /// Iterate over all keys found in the hash table
     template <typename CallbackT>
     void iterateAll(CallbackT&& callback) {
@@ -137,10 +150,15 @@ struct HashtableBuild : public TargetImpl<HashtableBuild> {
     /// A block
     struct Block;
 
+    /// The number of tuples after which a local state reports its progress
+    static constexpr size_t progressInterval = 1024;
+
     /// Local state
     struct LocalState {
         /// The number of collected tuplese
         size_t numTuples = 0;
+        /// The number of collected tuples at the next progress report
+        size_t nextReport = progressInterval;
         /// The shift for finding partition
         size_t partitionShift;
         /// The partitions
@@ -171,12 +189,22 @@ struct HashtableBuild : public TargetImpl<HashtableBuild> {
 
     /// Should we build a cross product table or a normal table?
     bool isCrossProduct = false;
+    /// The number of tuples after which the build requests its suspension. Unlimited by default
+    size_t suspendLimit = ~0ull;
+    /// The flag that requests the suspension of the pipeline, see TableScan::Suspension. While it is set, finishConsume does nothing
+    std::atomic<bool>* suspendRequest = nullptr;
+    /// The number of tuples that the local states reported
+    std::atomic<size_t> reportedTuples = 0;
+
+    /// Report the progress of a local state, requests the suspension if the limit is exceeded
+    void reportProgress(LocalState& ls);
     /// Add tuple to tuple materialization
     template <typename... AttrT>
     void operator()(LocalState& ls, uint64_t multiplicity, uint64_t key, AttrT... attrs) {
         constexpr size_t attrCount = sizeof...(attrs) + 2 + config::handleMultiplicity;
 
-        ls.numTuples++;
+        if (++ls.numTuples == ls.nextReport) [[unlikely]]
+            reportProgress(ls);
 
         auto hash = Hashtable::computeHashes(key).first;
         auto partition = hash >> partitionShift;
@@ -201,6 +229,8 @@ struct HashtableBuild : public TargetImpl<HashtableBuild> {
         }
         part.cur += attrCount;
     }
+    /// Get the number of collected tuples, must not run concurrently to the pipeline
+    size_t getNumTuples() const;
     /// Finish tuples
     void finishConsume();
     /// Constructor
@@ -242,7 +272,67 @@ struct HashtableProbe : OpBase {
     std::string getPretty() const override;
 };
 //---------------------------------------------------------------------------
+/// Duplicate elimination for the output.
+/// Tuples are collected in the partitioned chunks of a hash table build, keyed by a hash of the whole tuple.
+/// Every partition is then deduplicated on its own and the distinct tuples are written to a table target.
+struct DistinctTarget : public TargetImpl<DistinctTarget> {
+    /// Local state
+    struct LocalState {
+        /// The local state of the build
+        HashtableBuild::LocalState build;
+
+        explicit LocalState(DistinctTarget& target) : build(target.build) {}
+    };
+
+    /// The hash table used for deduplication
+    Hashtable ht;
+    /// The build collecting the tuples
+    HashtableBuild build;
+    /// The target receiving the distinct tuples
+    TableTarget output;
+    /// The columns containing strings, those are compared by value
+    uint32_t stringColumns = 0;
+
+    /// The columns containing doubles, their negative zero is stored as zero
+    uint32_t doubleColumns = 0;
+
+    /// Hash a string by value
+    static uint64_t hashString(uint64_t value);
+    /// Normalize a double such that equal values have equal bits, only zero has two representations
+    [[gnu::always_inline]] static uint64_t normalizeDouble(uint64_t value) {
+        constexpr uint64_t negativeZero = 1ull << 63;
+        return (value == negativeZero) ? 0 : value;
+    }
+    /// Combine a value into the tuple hash
+    [[gnu::always_inline]] static uint64_t hashCombine(uint64_t hash, uint64_t value) {
+        // the fibonacci hashing constant
+        return (hash ^ value) * 11400714819323198485llu;
+    }
+
+    /// Consume attributes
+    template <typename... AttrT>
+    void operator()(LocalState& ls, uint64_t multiplicity, AttrT... attrs) {
+        // The multiplicity does not matter, every distinct tuple is produced once
+        unsigned ind = 0;
+        if (doubleColumns) {
+            ((attrs = ((doubleColumns >> (ind++)) & 1) ? normalizeDouble(attrs) : attrs), ...);
+            ind = 0;
+        }
+        uint64_t hash = 0;
+        ((hash = hashCombine(hash, ((stringColumns >> (ind++)) & 1) ? hashString(attrs) : attrs)), ...);
+        // Equal tuples have equal keys and thus land in the same partition
+        build(ls.build, 1, hash >> 32, attrs...);
+    }
+    /// Deduplicate the collected tuples and write them to the output
+    void finishConsume();
+
+    /// Constructor
+    DistinctTarget(SmallVec<DataType>&& types, size_t cardEstimate);
+    std::string getPretty() const override;
+};
+//---------------------------------------------------------------------------
 static_assert(TargetOperator<HashtableBuild, 1>);
+static_assert(TargetOperator<DistinctTarget, 1>);
 //---------------------------------------------------------------------------
 }
 //---------------------------------------------------------------------------
@@ -1,15 +1,19 @@
 #include "op/TableScan.hpp"
 #include "infra/QueryMemory.hpp"
-#include "infra/Random.hpp"
 #include "infra/Scheduler.hpp"
 #include "infra/SmallVec.hpp"
 #include "infra/Util.hpp"
 #include "infra/helper/BitOps.hpp"
 #include "infra/helper/Misc.hpp"
+#include "storage/BitPacking.hpp"
 #include "storage/CopyLogic.hpp"
 #include "storage/RestrictionLogic.hpp"
 #include "storage/StringPtr.hpp"
+#include "storage/StringRestrictionLogic.hpp"
 #include <algorithm>
+#include <mutex>
+#include <numeric>
+#include <tuple>
 #include <unordered_map>
 #if defined(__x86_64__) && defined(__BMI2__)
 #include <immintrin.h>
@@ -96,6 +100,8 @@ struct TableScan::Reader {
     size_t nonNullIndex = 0;
     /// Selectivity
     double selectivity = 1.0;
+    /// The decoder if the pages are bit packed
+    BitPacking::Decoder* decoder = nullptr;
 
     virtual ~Reader() noexcept = default;
 
@@ -108,6 +114,13 @@ struct TableScan::Reader {
     /// Are we at the end?
     bool done() const noexcept { return curPage == endPage; }
 
+    /// Get the next count 32 bit values of the current page starting at the non-null index
+    const uint32_t* getValues32(size_t count) {
+        if (decoder)
+            return decoder->get(*curPage, nonNullIndex, count);
+        return (*curPage)->template getData<uint32_t>() + nonNullIndex;
+    }
+
     /// Find first element that is not greater than requestedId
     /// Assumption: requestedId >= *st && requestedId < *(en - 1)
     static size_t exponentialSearch(const uint32_t* st, const uint32_t* en, size_t requestedId) {
@@ -194,11 +207,17 @@ struct TableScan::Reader {
         return load64(static_cast<const uint8_t*>(bits), static_cast<const uint8_t*>(end));
     }
 
-    uint64_t getNextNotNulls() const {
+    /// Get the not-null bits of the 64 tuples that start offset tuples after the current one
+    uint64_t getNotNullsAt(size_t offset) const {
         if ((*curPage)->hasNoNulls())
             return ~0ull;
-        auto* base = (*curPage)->getNulls() + tupleIndex / 8;
-        return (load64(base + 1, (*curPage) + 1) << (8 - tupleIndex % 8)) | (*base >> (tupleIndex % 8));
+        size_t index = tupleIndex + offset;
+        auto* base = (*curPage)->getNulls() + index / 8;
+        return (load64(base + 1, (*curPage) + 1) << (8 - index % 8)) | (*base >> (index % 8));
+    }
+
+    uint64_t getNextNotNulls() const {
+        return getNotNullsAt(0);
     }
 
     void skipMany(size_t numTuples) {
@@ -288,10 +307,9 @@ struct ReaderT : public TableScan::Reader {
         uint64_t srcOffsets = pext(matches & notNulls, notNulls);
         uint64_t dstOffsets = pext(matches & notNulls, matches);
 
-        auto* baseData = (*curPage)->template getData<T>();
-        auto* data = baseData + nonNullIndex;
+        auto* data = (*curPage)->template getData<T>() + nonNullIndex;
         if constexpr (std::is_same<T, uint32_t>::value) {
-            CopyLogic::extractInt32(target, data, srcOffsets, dstOffsets, numTuples);
+            CopyLogic::extractInt32(target, getValues32(numTuples), srcOffsets, dstOffsets, numTuples);
         } else if constexpr (std::is_same<T, uint64_t>::value) {
             CopyLogic::extractInt64(target, data, srcOffsets, dstOffsets, numTuples);
         } else if constexpr (isString) {
@@ -324,21 +342,140 @@ struct ReaderT : public TableScan::Reader {
     }
 };
 //---------------------------------------------------------------------------
+/// Reader producing the row ids of the matching tuples instead of their values
+struct RowIdReader final : public TableScan::Reader {
+    /// The data type of the column
+    DataType type;
+
+    /// Constructor
+    RowIdReader(DataType type, DataSource::Page* const* curPage, DataSource::Page* const* endPage, const uint32_t* searchArray)
+        : Reader(curPage, endPage, searchArray), type(type) {}
+
+    DataType getDataType() const noexcept final { return type; }
+
+    /// Get the next elements
+    void step64(uint64_t* target, uint64_t matches, size_t numTuples) final {
+        if (numTuples == 0)
+            return;
+        assert(!done());
+        for (; matches; matches &= matches - 1)
+            *(target++) = rowId + engine::countr_zero(matches);
+        skipMany(numTuples);
+    }
+};
+//---------------------------------------------------------------------------
+/// Reader for dictionary encoded columns, produces the StringPtr values of the codes
+struct DictionaryReader final : public TableScan::Reader {
+    /// The dictionary
+    const uint64_t* dictionary;
+
+    /// Constructor
+    DictionaryReader(const uint64_t* dictionary, DataSource::Page* const* curPage, DataSource::Page* const* endPage, const uint32_t* searchArray)
+        : Reader(curPage, endPage, searchArray), dictionary(dictionary) {}
+
+    DataType getDataType() const noexcept final { return DataType::VARCHAR; }
+
+    /// Get the next elements
+    void step64(uint64_t* target, uint64_t matches, size_t numTuples) final {
+        if (numTuples == 0)
+            return;
+        assert(!done());
+        assert(numTuples <= (*curPage)->numRows - tupleIndex);
+        uint64_t notNulls = getNextNotNulls();
+        uint64_t srcOffsets = pext(matches & notNulls, notNulls);
+        uint64_t dstOffsets = pext(matches & notNulls, matches);
+        CopyLogic::extractDictionary(target, getValues32(numTuples), srcOffsets, dstOffsets, numTuples, dictionary);
+        skipMany(numTuples);
+    }
+};
+//---------------------------------------------------------------------------
 /// Reader for type
 struct TableScan::RestrictedReader final : public ReaderT<uint32_t> {
     const RestrictionLogic* applyRestriction;
+    /// The restriction of a string column. Such a reader is never used to produce values
+    const StringRestrictionLogic* stringRestriction;
+    /// The zone maps of the pages, if known
+    const DataSource::ZoneMap* zoneMaps;
+    /// Does the column have 64 bit values? Such a reader is never used to produce values either
+    bool wide = false;
+    /// The last page whose zone map did not exclude the restriction
+    DataSource::Page* const* mayMatchPage = nullptr;
 
     /// Constructor
-    RestrictedReader(DataSource::Page* const* curPage, DataSource::Page* const* endPage, const uint32_t* searchArray, TableScan::RestrictionInfo restrictionFunc)
-        : ReaderT<uint32_t>(curPage, endPage, searchArray), applyRestriction(restrictionFunc.restriction == RestrictionLogic::notNullRestriction ? nullptr : restrictionFunc.restriction) {
+    RestrictedReader(DataSource::Page* const* curPage, DataSource::Page* const* endPage, const uint32_t* searchArray, const DataSource::ZoneMap* zoneMaps, TableScan::RestrictionInfo restrictionFunc)
+        : ReaderT<uint32_t>(curPage, endPage, searchArray), applyRestriction(restrictionFunc.restriction == RestrictionLogic::notNullRestriction ? nullptr : restrictionFunc.restriction), stringRestriction(restrictionFunc.stringRestriction), zoneMaps(zoneMaps) {
         selectivity = restrictionFunc.selectivity;
     }
 
+    /// Can the current page contain any match according to its zone map?
+    bool pageMayMatch() {
+        if (!zoneMaps || curPage == mayMatchPage)
+            return true;
+        auto& zoneMap = zoneMaps[curPage - startPage];
+        bool result = zoneMap.hasValues();
+        if (result && stringRestriction)
+            result = stringRestriction->mayMatch(zoneMap.min, zoneMap.max);
+        else if (result && applyRestriction)
+            result = applyRestriction->mayMatch(zoneMap.min, zoneMap.max);
+        if (result)
+            mayMatchPage = curPage;
+        return result;
+    }
+
+    /// Get the 64 bit values of the current page starting at the non-null index
+    const uint64_t* getValues64() const {
+        return (*curPage)->template getData<uint64_t>() + nonNullIndex;
+    }
+
+    /// Check the long string that starts at the current page
+    bool checkLongString() const {
+        assert((*curPage)->isLongStringStart());
+        auto* pages = curPage + 1;
+        for (; pages != endPage && (*pages)->isLongStringContinuation(); pages++);
+        return stringRestriction->check(StringPtr::fromLongString(const_cast<DataSource::Page**>(curPage), pages - curPage));
+    }
+
+    /// Check the upcoming strings for whether they match the restriction
+    uint64_t peekStrings64(uint64_t existingMask, size_t numTuples) {
+        if ((*curPage)->isLongStringStart()) [[unlikely]] {
+            assert(numTuples == 1);
+            return (existingMask & 1) && checkLongString();
+        }
+        uint64_t notNulls = getNextNotNulls();
+        uint64_t mask = existingMask & notNulls;
+        if (!mask)
+            return 0;
+        uint64_t srcOffsets = pext(mask, notNulls);
+
+        auto* page = *curPage;
+        uint64_t newMask = stringRestriction->run(page->getStrings(), page->template getData<uint16_t>(), nonNullIndex, srcOffsets);
+
+        // Expand the newMask to notNulls
+        return mask & pdep(newMask, notNulls);
+    }
+
+    /// Check the upcoming strings for whether they match the restriction
+    /// Skip as far as possible
+    std::pair<uint64_t, size_t> peekFirstStrings(size_t numTuples) {
+        size_t skipped = 0;
+        while (skipped < numTuples) {
+            auto step = std::min<size_t>(numTuples - skipped, 64);
+            uint64_t mask = peekStrings64(~0ull >> (64 - step), step);
+            if (mask)
+                return {mask, skipped};
+            skipMany(step);
+            skipped += step;
+        }
+        return {0, numTuples};
+    }
+
     /// Check the upcoming elements for whether they match the restriction
     uint64_t peek64(uint64_t existingMask, size_t numTuples) {
         assert(numTuples != 0);
         assert(numTuples <= (*curPage)->numRows - tupleIndex);
 
+        if (stringRestriction)
+            return peekStrings64(existingMask, numTuples);
         if (!applyRestriction)
             return (*curPage)->hasNoNulls() ? existingMask : existingMask & getNextNotNulls();
 
@@ -349,9 +486,7 @@ struct TableScan::RestrictedReader final : public ReaderT<uint32_t> {
             return 0;
         uint64_t srcOffsets = pext(mask, notNulls);
 
-        auto* values = (*curPage)->template getData<uint32_t>() + nonNullIndex;
-
-        uint64_t newMask = applyRestriction->run(values, srcOffsets);
+        uint64_t newMask = wide ? applyRestriction->run(getValues64(), srcOffsets) : applyRestriction->run(getValues32(numTuples), srcOffsets);
 
         // Expand the newMask to notNulls
         uint64_t matches = pdep(newMask, notNulls);
@@ -361,6 +496,89 @@ struct TableScan::RestrictedReader final : public ReaderT<uint32_t> {
         return mask;
     }
 
+    /// Select the tuples among the next numTuples that satisfy the restriction and write their offsets to selection.
+    /// Returns the number of selected tuples, does not move the reader
+    size_t select(uint16_t* selection, size_t numTuples) {
+        assert(numTuples <= selectionBatchSize);
+        assert(numTuples <= (*curPage)->numRows - tupleIndex);
+
+        if (!pageMayMatch())
+            return 0;
+        if (stringRestriction || wide) {
+            std::iota(selection, selection + numTuples, 0);
+            return refineWindows(selection, numTuples, numTuples);
+        }
+        auto* values = applyRestriction ? getValues32(numTuples) : nullptr;
+        size_t count = 0;
+        for (size_t offset = 0; offset < numTuples; offset += 64) {
+            uint64_t mask = getNotNullsAt(offset) & (~0ull >> (64 - std::min<size_t>(numTuples - offset, 64)));
+            if (values && mask) {
+                auto notNullCount = engine::popcount(mask);
+                mask = pdep(applyRestriction->runDense(values, notNullCount), mask);
+                values += notNullCount;
+            }
+            for (; mask; mask &= mask - 1)
+                selection[count++] = offset + engine::countr_zero(mask);
+        }
+        return count;
+    }
+
+    /// Remove the tuples from the selection of the next numTuples that do not satisfy the restriction.
+    /// Gathers the values of the selected tuples into buffer and checks them densely. Returns the new size of the selection, does not move the reader
+    size_t refine(uint16_t* selection, size_t count, size_t numTuples, uint32_t* buffer) {
+        assert(numTuples <= selectionBatchSize);
+        assert(numTuples <= (*curPage)->numRows - tupleIndex);
+
+        if (!count || !pageMayMatch())
+            return 0;
+        if (stringRestriction || wide)
+            return refineWindows(selection, count, numTuples);
+        auto* values = applyRestriction ? getValues32(numTuples) : nullptr;
+        // The selection is sorted, so the non-null index of the windows can be counted on the fly
+        size_t kept = 0, nextWindow = 0, windowNonNullIndex = 0;
+        uint64_t notNulls = 0;
+        for (size_t i = 0; i < count; i++) {
+            size_t offset = selection[i];
+            for (; nextWindow <= offset / 64; nextWindow++) {
+                windowNonNullIndex += engine::popcount(notNulls);
+                notNulls = getNotNullsAt(nextWindow * 64);
+            }
+            uint64_t bit = 1ull << (offset % 64);
+            if (!(notNulls & bit))
+                continue;
+            if (values)
+                buffer[kept] = values[windowNonNullIndex + engine::popcount(notNulls & (bit - 1))];
+            selection[kept++] = offset;
+        }
+        if (!values)
+            return kept;
+
+        size_t result = 0;
+        for (size_t i = 0; i < kept; i += 64)
+            for (uint64_t mask = applyRestriction->runDense(buffer + i, std::min<size_t>(kept - i, 64)); mask; mask &= mask - 1)
+                selection[result++] = selection[i + engine::countr_zero(mask)];
+        return result;
+    }
+
+    /// Refine the selection window by window, used for the restrictions whose values cannot be gathered into a 32 bit buffer
+    size_t refineWindows(uint16_t* selection, size_t count, size_t numTuples) {
+        // Move to the windows and back afterwards
+        auto position = std::make_tuple(curPage, rowId, tupleIndex, nonNullIndex);
+        size_t result = 0, offset = 0;
+        for (size_t i = 0; i < count;) {
+            size_t window = selection[i] & ~63ull;
+            uint64_t mask = 0;
+            for (; i < count && selection[i] < window + 64; i++)
+                mask |= 1ull << (selection[i] - window);
+            skipMany(window - offset);
+            offset = window;
+            for (mask = peek64(mask, std::min<size_t>(numTuples - window, 64)); mask; mask &= mask - 1)
+                selection[result++] = window + engine::countr_zero(mask);
+        }
+        std::tie(curPage, rowId, tupleIndex, nonNullIndex) = position;
+        return result;
+    }
+
     /// Check the upcoming elements for whether they match the restriction
     /// Skip as far as possible
     std::pair<uint64_t, size_t> peekFirst(size_t numTuples) {
@@ -368,12 +586,19 @@ struct TableScan::RestrictedReader final : public ReaderT<uint32_t> {
         assert(numTuples != 0);
         assert(numTuples <= (*curPage)->numRows - tupleIndex);
 
-        if ((*curPage)->hasNoNulls()) {
+        // Skip the remainder of pages that cannot contain any match
+        if (!pageMayMatch()) {
+            skipMany(numTuples);
+            return {0, numTuples};
+        }
+        if (stringRestriction)
+            return peekFirstStrings(numTuples);
+        if ((*curPage)->hasNoNulls() && !wide) {
             // If we do not have any nulls and we have a not null restriction, we can skip nothing
             if (!applyRestriction)
                 return {~0ull >> (64 - std::min<size_t>(numTuples, 64)), 0};
             assert(tupleIndex < (*curPage)->numRows);
-            auto* values = (*curPage)->template getData<uint32_t>() + nonNullIndex;
+            auto* values = getValues32(numTuples);
             auto [mask, skipped] = applyRestriction->runAndSkip(values, numTuples);
             assert(skipped <= numTuples);
             tupleIndex += skipped;
@@ -390,8 +615,7 @@ struct TableScan::RestrictedReader final : public ReaderT<uint32_t> {
                 uint64_t mask = notNulls & (~0ull >> (64 - step));
                 auto notNullCount = engine::popcount(mask);
                 if (applyRestriction && notNullCount) {
-                    auto* values = (*curPage)->template getData<uint32_t>() + nonNullIndex;
-                    uint64_t newMask = applyRestriction->runDense(values, notNullCount);
+                    uint64_t newMask = wide ? applyRestriction->runDense64(getValues64(), notNullCount) : applyRestriction->runDense(getValues32(notNullCount), notNullCount);
                     mask = pdep(newMask, notNulls);
                 }
 #ifndef NDEBUG
@@ -426,9 +650,42 @@ static UniquePtr<TableScan::Reader> makeReader(DataType type, DataSource::Page*
     __builtin_unreachable();
 }
 //---------------------------------------------------------------------------
+/// Make a decoder if the column is bit packed
+static BitPacking::Decoder* makeDecoder(const TableScan::ColumnInfo& col) {
+    if (!col.bitPacked)
+        return nullptr;
+    return new (querymemory::allocate(sizeof(BitPacking::Decoder))) BitPacking::Decoder();
+}
+//---------------------------------------------------------------------------
+/// Make a reader for the values of a column
+static UniquePtr<TableScan::Reader> makeReader(const TableScan::ColumnInfo& col) {
+    UniquePtr<TableScan::Reader> result;
+    if (!col.dictionary.empty())
+        result = makeUnique<DictionaryReader>(col.dictionary.data(), col.pages.data(), col.pages.data() + col.pages.size(), col.pageOffsets);
+    else
+        result = makeReader(col.type, col.pages.data(), col.pages.data() + col.pages.size(), col.pageOffsets);
+    result->decoder = makeDecoder(col);
+    return result;
+}
+//---------------------------------------------------------------------------
 /// Make a restricted reader given type
-static UniquePtr<TableScan::RestrictedReader> makeRestrictedReader(DataSource::Page* const* curPage, DataSource::Page* const* endPage, const uint32_t* searchArray, TableScan::RestrictionInfo func) {
-    return makeUnique<TableScan::RestrictedReader>(curPage, endPage, searchArray, func);
+static UniquePtr<TableScan::RestrictedReader> makeRestrictedReader(const TableScan::ColumnInfo& col, TableScan::RestrictionInfo func) {
+    auto result = makeUnique<TableScan::RestrictedReader>(col.pages.data(), col.pages.data() + col.pages.size(), col.pageOffsets, col.zoneMaps, func);
+    // Restrictions on strings read the pages directly
+    if (!func.stringRestriction)
+        result->decoder = makeDecoder(col);
+    result->wide = (col.type == DataType::INT64) || (col.type == DataType::FP64);
+    return result;
+}
+//---------------------------------------------------------------------------
+/// The estimated selectivity of a restriction
+static double estimateSelectivity(const TableScan::RestrictionInfo& info) {
+    return info.stringRestriction ? info.stringRestriction->estimateSelectivity() : info.restriction->estimateSelectivity();
+}
+//---------------------------------------------------------------------------
+/// The estimated cost of a restriction
+static double estimateCost(const TableScan::RestrictionInfo& info) {
+    return info.stringRestriction ? info.stringRestriction->estimateCost() : info.restriction->estimateCost();
 }
 //---------------------------------------------------------------------------
 /// Constructor
@@ -436,6 +693,23 @@ TableScan::TableScan(TableInfo& table, const SmallVec<unsigned>& cols, const Sma
     UnorderedMap<unsigned, RestrictionInfo> colRestrictions;
     colRestrictions.reserve(restrictions.size());
     for (auto& r : restrictions) {
+        // Evaluate string restrictions on dictionary encoded columns once per entry, the readers then only check the codes
+        if (auto& dictionary = table.columns[r.column]->dictionary; r.stringRestriction && !dictionary.empty()) {
+            SmallVec<uint32_t> codes;
+            for (uint32_t code = 0; code < dictionary.size(); code++)
+                if (r.stringRestriction->check(StringPtr(dictionary[code])))
+                    codes.push_back(code);
+            auto* logic = codeRestrictions.emplace_back(RestrictionLogic::setupCodeSet(codes, dictionary.size())).get();
+            restrictedReaderDefs.emplace_back(false, nonOutputReaderDefs.size());
+            nonOutputReaderDefs.emplace_back(ReaderDef{r.column, RestrictionInfo{r.column, r.selectivity, logic}});
+            continue;
+        }
+        // Restricted readers produce 32 bit integers, string and 64 bit columns are restricted by an additional reader
+        if (r.stringRestriction || table.columns[r.column]->type == DataType::INT64 || table.columns[r.column]->type == DataType::FP64) {
+            restrictedReaderDefs.emplace_back(false, nonOutputReaderDefs.size());
+            nonOutputReaderDefs.emplace_back(ReaderDef{r.column, r});
+            continue;
+        }
         assert(colRestrictions.find(r.column) == colRestrictions.end());
         colRestrictions[r.column] = r;
     }
@@ -461,14 +735,13 @@ TableScan::TableScan(TableInfo& table, const SmallVec<unsigned>& cols, const Sma
     std::sort(restrictedReaderDefs.begin(), restrictedReaderDefs.end(), [&](auto& aindex, auto& bindex) -> bool {
         auto& a = std::get<0>(aindex) ? readerDefs[std::get<1>(aindex)].info : nonOutputReaderDefs[std::get<1>(aindex)].info;
         auto& b = std::get<0>(bindex) ? readerDefs[std::get<1>(bindex)].info : nonOutputReaderDefs[std::get<1>(bindex)].info;
-        auto *arest = a.restriction, *brest = b.restriction;
 
         auto asel = a.selectivity, bsel = b.selectivity;
         if (asel == bsel) {
-            asel = arest->estimateSelectivity();
-            bsel = brest->estimateSelectivity();
+            asel = estimateSelectivity(a);
+            bsel = estimateSelectivity(b);
         }
-        auto acost = arest->estimateCost(), bcost = brest->estimateCost();
+        auto acost = estimateCost(a), bcost = estimateCost(b);
 
         return (1 - asel) / acost > (1 - bsel) / bcost;
     });
@@ -504,18 +777,23 @@ TableScan::LocalState::LocalState(TableScan& scan) {
     readers.reserve(scan.readerDefs.size());
     nonOutputReaders.reserve(scan.nonOutputReaderDefs.size());
 
-    for (auto& [c, f] : scan.readerDefs) {
+    for (size_t i = 0; i < scan.readerDefs.size(); i++) {
+        auto& [c, f] = scan.readerDefs[i];
         auto& col = *scan.table.columns[c];
-        if (f.restriction)
-            readers.emplace_back(makeRestrictedReader(col.pages.data(), col.pages.data() + col.pages.size(), col.pageOffsets, f));
-        else
-            readers.emplace_back(makeReader(col.type, col.pages.data(), col.pages.data() + col.pages.size(), col.pageOffsets));
+        if (f.restriction) {
+            assert(!(scan.lateMaterialized & (1ull << i)));
+            readers.emplace_back(makeRestrictedReader(col, f));
+        } else if (scan.lateMaterialized & (1ull << i)) {
+            readers.emplace_back(makeUnique<RowIdReader>(col.type, col.pages.data(), col.pages.data() + col.pages.size(), col.pageOffsets));
+        } else {
+            readers.emplace_back(makeReader(col));
+        }
     }
     for (auto& [c, f] : scan.nonOutputReaderDefs) {
-        assert(f.restriction);
+        assert(f.restriction || f.stringRestriction);
         assert(c < scan.table.columns.size());
         auto& col = *scan.table.columns[c];
-        nonOutputReaders.emplace_back(makeRestrictedReader(col.pages.data(), col.pages.data() + col.pages.size(), col.pageOffsets, f));
+        nonOutputReaders.emplace_back(makeRestrictedReader(col, f));
     }
     values.resize((readers.size() + (scan.produceConstantColumn != ~0ull)) * bufferCount + bufferCount);
     valueIndex = 0;
@@ -538,11 +816,31 @@ TableScan::LocalState::LocalState(TableScan& scan) {
         allReaders.push_back(reader.get());
     for (auto& reader : nonOutputReaders)
         allReaders.push_back(reader.get());
+
+    if (!restrictedReaders.empty()) {
+        selection.resize(selectionBatchSize);
+        selectionValues.resize(selectionBatchSize);
+    }
 }
 //---------------------------------------------------------------------------
 TableScan::LocalState::LocalState(LocalState&&) noexcept = default;
 TableScan::LocalState::~LocalState() noexcept = default;
 //---------------------------------------------------------------------------
+void TableScan::LocalState::observe(size_t checked, size_t selected) {
+    checkedTuples += checked;
+    selectedTuples += selected;
+    if (checkedTuples < selectionInterval)
+        return;
+    // Sparse matches leave most bitmasks empty, dense matches make the selection vector expensive. Extremely sparse matches are
+    // skipped fastest by runAndSkip of the bitmask mode. Switch with a hysteresis to avoid flapping
+    if (selectionMode)
+        selectionMode = selectedTuples * 8 < checkedTuples && selectedTuples * 4096 > checkedTuples;
+    else
+        selectionMode = selectedTuples * 32 < checkedTuples && selectedTuples * 1024 > checkedTuples;
+    checkedTuples /= 2;
+    selectedTuples /= 2;
+}
+//---------------------------------------------------------------------------
 [[gnu::noinline]] uint32_t* makeSearchVector(engine::span<DataSource::Page* const> pages) {
     auto* res = static_cast<uint32_t*>(querymemory::allocate((pages.size() + 1) * sizeof(uint32_t)));
     res[0] = 0;
@@ -578,6 +876,12 @@ TableScan::ColumnInfo TableScan::prepareColumn(size_t numRows, DataSource::Colum
     result.type = column.type;
     result.pages = column.pages;
     result.pageOffsets = makeSearchVector(column.pages);
+    if (column.zoneMaps.size() == column.pages.size())
+        result.zoneMaps = column.zoneMaps.data();
+    result.dictionary = column.dictionary;
+    result.bitPacked = column.bitPacked;
+    result.mapped = column.mapped;
+    result.readAheadPages = &column.readAhead.pages;
     return result;
 }
 //---------------------------------------------------------------------------
@@ -613,6 +917,38 @@ size_t TableScan::concurrency() const {
     return Scheduler::concurrency();
 }
 //---------------------------------------------------------------------------
+std::pair<size_t, size_t> TableScan::getPageRange(const ColumnInfo& column, size_t begin, size_t end) {
+    auto* offsets = column.pageOffsets;
+    auto* offsetsEnd = offsets + column.pages.size() + 1;
+    size_t first = std::upper_bound(offsets, offsetsEnd, begin) - offsets - 1;
+    size_t last = std::min<size_t>(std::lower_bound(offsets, offsetsEnd, end) - offsets, column.pages.size());
+    return {first, std::max(first, last)};
+}
+//---------------------------------------------------------------------------
+void TableScan::readAhead(size_t row) const {
+    if (row >= morselEnd)
+        return;
+    size_t end = std::min(row + morselSize, morselEnd);
+    auto advise = [&](unsigned column) {
+        auto& col = *table.columns[column];
+        if (!col.mapped || col.pages.empty() || !col.readAheadPages)
+            return;
+        // Only the first pass over a column issues hints, afterwards its pages are usually in the page cache. The mark counts the leading
+        // pages that were read ahead. A morsel behind skipped pages is read ahead without advancing it, so a later scan still reads them ahead
+        auto [first, last] = getPageRange(col, row, end);
+        size_t advised = col.readAheadPages->load(std::memory_order_relaxed);
+        while (first <= advised && advised < last && !col.readAheadPages->compare_exchange_weak(advised, last, std::memory_order_relaxed));
+        if (advised >= last)
+            return;
+        DataSource::willNeed({col.pages.data() + std::max(first, advised), col.pages.data() + last});
+    };
+    for (size_t i = 0; i < readerDefs.size(); i++)
+        if (!(lateMaterialized & (1ull << i)))
+            advise(readerDefs[i].column);
+    for (auto& def : nonOutputReaderDefs)
+        advise(def.column);
+}
+//---------------------------------------------------------------------------
 void TableScan::produceImpl(FunctionRef<std::pair<void*, LocalState*>(size_t workerId)> getLocalState, FunctionRef<void(void* localStates, const uint64_t* values, const uint64_t* valuesEnd)> callback, FunctionRef<void(size_t workerId, void* localStateRaw, bool isInit)> init) {
     using namespace std;
 
@@ -628,6 +964,9 @@ void TableScan::produceImpl(FunctionRef<std::pair<void*, LocalState*>(size_t wor
             return;
         }
 
+        // The kernel reads the next morsel of mapped columns while this one is processed
+        readAhead(row + morselSize);
+
         const size_t end = std::min(row + morselSize, static_cast<size_t>(table.numRows));
         auto& readers = ls->readers;
         auto& allReaders = ls->allReaders;
@@ -654,6 +993,38 @@ void TableScan::produceImpl(FunctionRef<std::pair<void*, LocalState*>(size_t wor
             }
 
             assert(maxTuples);
+            if (ls->selectionMode && maxTuples >= minSelectionBatchSize) {
+                // Filter a whole batch into a selection vector, then produce the windows that contain selected tuples
+                size_t numTuples = std::min(maxTuples, selectionBatchSize);
+                auto* selection = ls->selection.data();
+                size_t count = restrictedReaders[0]->select(selection, numTuples);
+                ls->observe(numTuples, count);
+                for (size_t r = 1; r < restrictedReaders.size() && count; r++)
+                    count = restrictedReaders[r]->refine(selection, count, numTuples, ls->selectionValues.data());
+
+                for (size_t i = 0; i < count;) {
+                    size_t window = selection[i] & ~63ull;
+                    uint64_t mask = 0;
+                    for (; i < count && selection[i] < window + 64; i++)
+                        mask |= 1ull << (selection[i] - window);
+                    auto step = std::min<size_t>(numTuples - window, 64);
+                    uint64_t* target = values.data() + valueIndex;
+                    for (auto& reader : readers) {
+                        reader->skipMany(row + window - reader->rowId);
+                        reader->step64(target, mask, step);
+                        target += bufferCount;
+                    }
+                    valueIndex += engine::popcount(mask);
+                    if (valueIndex >= bufferCount / 2) {
+                        callback(lsRaw, values.data(), values.data() + valueIndex);
+                        valueIndex = 0;
+                    }
+                }
+                row += numTuples;
+                for (auto* reader : allReaders)
+                    reader->skipMany(row - reader->rowId);
+                continue;
+            }
             uint64_t mask = ~0ull >> (64 - std::min<size_t>(maxTuples, 64));
             if (!restrictedReaders.empty()) {
                 size_t skipped = 0;
@@ -663,6 +1034,7 @@ void TableScan::produceImpl(FunctionRef<std::pair<void*, LocalState*>(size_t wor
                     skipped += newSkipped;
 
                     auto count = std::min<size_t>(maxTuples - skipped, 64);
+                    ls->observe(newSkipped + count, engine::popcount(mask));
                     if (mask) {
                         for (size_t r = 1; r < restrictedReaders.size(); r++) {
                             auto* reader = restrictedReaders[r];
@@ -727,48 +1099,114 @@ void TableScan::produceImpl(FunctionRef<std::pair<void*, LocalState*>(size_t wor
             valueIndex = 0;
         }
     };
-    if (concurrency() <= 1) {
-        logic(0, ~0ull - 1);
-        size_t row = 0;
-        while (row < morselEnd) {
-            logic(0, row);
-            row += morselSize;
+    // A resumed scan only scans the morsels that were left when it was suspended
+    bool resuming = suspension && suspension->resuming;
+    Vector<size_t> morsels;
+    if (resuming) {
+        morsels = std::move(suspension->remainingMorsels);
+        suspension->remainingMorsels.clear();
+        suspension->resuming = false;
+    }
+    auto task = [&](size_t workerId, size_t i) {
+        if (i >= ~0ull - 1)
+            return logic(workerId, i);
+        size_t row = resuming ? morsels[i] : i * morselSize;
+        if (suspension && suspension->requested.load(std::memory_order_relaxed)) {
+            std::unique_lock lock(suspension->mutex);
+            suspension->remainingMorsels.push_back(row);
+            return;
         }
-        logic(0, ~0ull);
+        logic(workerId, row);
+    };
+    size_t numMorsels = resuming ? morsels.size() : getNumMorsels();
+    if (concurrency() <= 1) {
+        task(0, ~0ull - 1);
+        for (size_t i = 0; i < numMorsels; i++)
+            task(0, i);
+        task(0, ~0ull);
     } else {
-        Scheduler::parallelMorsel(0, morselEnd, morselSize, logic, true);
+        Scheduler::parallelMorsel(0, numMorsels, 1, task, true);
+    }
+}
+//---------------------------------------------------------------------------
+void TableScan::sampleColumn(const ColumnInfo& column, engine::span<const uint64_t> rowIds, uint32_t* values) {
+    ReaderT<uint32_t> reader(column.pages.data(), column.pages.data() + column.pages.size(), column.pageOffsets);
+    reader.decoder = makeDecoder(column);
+    for (size_t ind = 0; ind < rowIds.size(); ind++) {
+        reader.skipTo(rowIds[ind]);
+        bool isNull = (*reader.curPage)->isNull(reader.tupleIndex);
+        values[ind] = isNull ? static_cast<uint32_t>(RuntimeValue::nullValue) : *reader.getValues32(1);
     }
 }
 //---------------------------------------------------------------------------
-Vector<uint32_t> TableScan::createUnfilteredSample(size_t sampleSize) const {
-    SmallVec<ReaderT<uint32_t>> readers;
-    for (auto& [c, f] : readerDefs) {
+void TableScan::filterSample(engine::span<const uint64_t> rowIds, uint64_t* matches) const {
+    for (auto& [c, f] : nonOutputReaderDefs) {
         auto& col = *table.columns[c];
-        readers.emplace_back(col.pages.data(), col.pages.data() + col.pages.size(), col.pageOffsets);
+        // The string restrictions of dictionary encoded columns are checked on the codes
+        bool checkCodes = !col.dictionary.empty() && f.restriction;
+        bool checkWide = (col.type == DataType::INT64 || col.type == DataType::FP64) && f.restriction;
+        if (!f.stringRestriction && !checkCodes && !checkWide)
+            continue;
+        ReaderT<uint16_t> stringReader(col.pages.data(), col.pages.data() + col.pages.size(), col.pageOffsets);
+        ReaderT<uint32_t> codeReader(col.pages.data(), col.pages.data() + col.pages.size(), col.pageOffsets);
+        ReaderT<uint64_t> wideReader(col.pages.data(), col.pages.data() + col.pages.size(), col.pageOffsets);
+        codeReader.decoder = makeDecoder(col);
+        TableScan::Reader& reader = checkCodes ? static_cast<TableScan::Reader&>(codeReader) : checkWide ? static_cast<TableScan::Reader&>(wideReader) : stringReader;
+        for (size_t ind = 0; ind < rowIds.size(); ind++) {
+            // Rows that failed an earlier restriction are skipped
+            if (!(matches[ind / 64] & (1ull << (ind % 64))))
+                continue;
+            reader.skipTo(rowIds[ind]);
+            while ((*reader.curPage)->numRows == 0)
+                reader.curPage++;
+            // Nulls are not written by the reader
+            uint64_t value = nullValue;
+            reader.step64(&value, 1, 1);
+            bool match = value != nullValue;
+            if (match && checkCodes) {
+                uint32_t code = value;
+                match = f.restriction->runDense(&code, 1);
+            } else if (match && checkWide) {
+                match = (f.restriction == RestrictionLogic::notNullRestriction) || f.restriction->runDense64(&value, 1);
+            } else if (match) {
+                match = f.stringRestriction->check(StringPtr(value));
+            }
+            if (!match)
+                matches[ind / 64] &= ~(1ull << (ind % 64));
+        }
     }
-
-    assert(sampleSize <= table.numRows);
-    Random rng;
-    SmallVec<uint64_t> rowIds;
-    rowIds.reserve(sampleSize);
-    for (size_t i = 0; i < sampleSize; i++)
-        rowIds.push_back(rng.nextRange(table.numRows));
-    std::sort(rowIds.begin(), rowIds.end());
-
-    Vector<uint32_t> result(sampleSize * readers.size());
-
-    for (size_t ind = 0; ind < rowIds.size(); ind++) {
-        auto rowId = rowIds[ind];
-        for (auto& reader : readers)
-            reader.skipTo(rowId);
-        for (size_t col = 0; col < readers.size(); col++) {
-            auto& reader = readers[col];
-            bool isNull = (*reader.curPage)->isNull(reader.tupleIndex);
-            result[ind + col * sampleSize] = isNull ? static_cast<uint32_t>(RuntimeValue::nullValue) : (*reader.curPage)->template get<uint32_t>(reader.nonNullIndex);
+}
+//---------------------------------------------------------------------------
+LateMaterializer::LateMaterializer(const TableScan::ColumnInfo& column)
+    : column(column), reader(makeReader(column)) {
+}
+//---------------------------------------------------------------------------
+LateMaterializer::~LateMaterializer() noexcept = default;
+//---------------------------------------------------------------------------
+UniquePtr<LateMaterializer> LateMaterializer::clone() const {
+    return makeUnique<LateMaterializer>(column);
+}
+//---------------------------------------------------------------------------
+void LateMaterializer::resolve(uint64_t* values, size_t count) {
+    // The reader only skips forward cheaply, a smaller row id searches from the first page again. Resolve the row ids in ascending
+    // order, every distinct row id once
+    order.clear();
+    for (size_t i = 0; i < count; i++)
+        order.emplace_back(values[i], i);
+    std::sort(order.begin(), order.end());
+    uint64_t rowId = ~0ull, value = 0;
+    for (auto [id, pos] : order) {
+        if (id != rowId) {
+            reader->skipTo(id);
+            while ((*reader->curPage)->numRows == 0)
+                reader->curPage++;
+            // Nulls are not written by the reader
+            value = TableScan::nullValue;
+            reader->step64(&value, 1, 1);
+            rowId = id;
         }
+        values[pos] = value;
     }
-
-    return result;
 }
 //---------------------------------------------------------------------------
 std::string_view TableScan::getTableName() const noexcept {
@@ -7,13 +7,16 @@
 #include "op/ScanBase.hpp"
 #include "query/DataSource.hpp"
 #include "query/Restriction.hpp"
+#include <atomic>
 #include <memory>
+#include <mutex>
 #include <optional>
 //---------------------------------------------------------------------------
 namespace engine {
 //---------------------------------------------------------------------------
 class QueryMemory;
 class RestrictionLogic;
+class StringRestrictionLogic;
 //---------------------------------------------------------------------------
 class TableScan : public ScanImpl<TableScan> {
     public:
@@ -31,10 +34,20 @@ class TableScan : public ScanImpl<TableScan> {
         SmallVec<Reader*> allReaders;
         /// The current index within values
         size_t valueIndex = 0;
+        /// The selection vector and the gathered values of the selection vector mode
+        SmallVec<uint16_t> selection;
+        SmallVec<uint32_t> selectionValues;
+        /// The tuples checked by the first restriction and how many of them it selected
+        size_t checkedTuples = 0, selectedTuples = 0;
+        /// Filter batches into a selection vector instead of 64 tuple bitmasks?
+        bool selectionMode = false;
 
         LocalState(TableScan& scan);
         ~LocalState() noexcept;
         LocalState(LocalState&&) noexcept;
+
+        /// Update the density of the first restriction and choose between the bitmask and the selection vector mode
+        void observe(size_t checked, size_t selected);
     };
 
     /// The columns we want to scan
@@ -45,10 +58,22 @@ class TableScan : public ScanImpl<TableScan> {
         engine::span<DataSource::Page* const> pages;
         /// The page offset prefix sum for accelerating scans
         uint32_t* pageOffsets;
+        /// The zone maps of the pages, if known
+        const DataSource::ZoneMap* zoneMaps = nullptr;
+        /// The StringPtr values of the codes if the VARCHAR column is dictionary encoded
+        engine::span<const uint64_t> dictionary = {};
+        /// Are the pages bit packed?
+        bool bitPacked = false;
+        /// Do the pages live in a file mapping? Then the scan reads them ahead
+        bool mapped = false;
+        /// The number of leading pages that were already read ahead, shared by all scans of the column
+        std::atomic<size_t>* readAheadPages = nullptr;
     };
 
     /// Prepare column information
     static ColumnInfo prepareColumn(size_t numRows, DataSource::Column& column);
+    /// The range of pages that contain the rows [begin, end)
+    static std::pair<size_t, size_t> getPageRange(const ColumnInfo& column, size_t begin, size_t end);
 
     /// The pages we want to scan
     struct TableInfo {
@@ -70,11 +95,25 @@ class TableScan : public ScanImpl<TableScan> {
     /// Make table info from table. For tests
     static TableInfo makeTableInfo(DataSource::Table& table);
 
+    /// Allows suspending a scan between morsels and resuming it later. The morsels that are running when the scan is suspended are completed
+    struct Suspension {
+        /// Is suspending requested?
+        std::atomic<bool> requested = false;
+        /// The mutex for the remaining morsels
+        std::mutex mutex;
+        /// The first rows of the morsels that were not scanned
+        Vector<size_t> remainingMorsels;
+        /// Only scan the remaining morsels in the next run?
+        bool resuming = false;
+    };
+
     /// Info on restriction
     struct RestrictionInfo {
         unsigned column;
         double selectivity;
         const RestrictionLogic* restriction;
+        /// The restriction of a VARCHAR column, restriction is unused then
+        const StringRestrictionLogic* stringRestriction = nullptr;
     };
 
     private:
@@ -90,6 +129,8 @@ class TableScan : public ScanImpl<TableScan> {
     SmallVec<ReaderDef> nonOutputReaderDefs;
     /// The restricted readers
     SmallVec<std::tuple<bool, unsigned>> restrictedReaderDefs;
+    /// The string restrictions on dictionary encoded columns translated to their codes
+    SmallVec<UniquePtr<RestrictionLogic>> codeRestrictions;
     /// The first column of the table
     unsigned firstColumn = 0;
     size_t morselEnd = 0;
@@ -97,13 +138,25 @@ class TableScan : public ScanImpl<TableScan> {
 
     /// Number of tuples in buffer
     static constexpr size_t bufferCount = 128;
+    /// Number of tuples that the selection vector mode filters at once
+    static constexpr size_t selectionBatchSize = 2048;
+    /// Smaller batches, e.g., at the end of a page, use the bitmask mode
+    static constexpr size_t minSelectionBatchSize = 256;
+    /// Number of checked tuples after which the mode is reconsidered
+    static constexpr size_t selectionInterval = 1 << 14;
 
+    /// Hint that the pages of the morsel that starts at row will be read soon
+    void readAhead(size_t row) const;
     /// Implementation for produce
     void produceImpl(FunctionRef<std::pair<void*, LocalState*>(size_t workerId)> getLocalState, FunctionRef<void(void* localStateRaw, const uint64_t* values, const uint64_t* valuesEnd)> callback, FunctionRef<void(size_t workerId, void* localStateRaw, bool isInit)> init);
 
     public:
     /// Produce an additional final column just containing a constant value
     uint64_t produceConstantColumn = ~0ull;
+    /// The produced columns that contain row ids instead of values, see LateMaterializer
+    uint64_t lateMaterialized = 0;
+    /// The suspension, if the scan may be suspended
+    Suspension* suspension = nullptr;
 
     /// Constructor
     TableScan(TableInfo& table, const SmallVec<unsigned>& cols, const SmallVec<RestrictionInfo>& restrictions, double mult, double selectivity);
@@ -114,6 +167,8 @@ class TableScan : public ScanImpl<TableScan> {
 
     /// Get the number of produced columns
     size_t getProducedColumns() const noexcept { return readerDefs.size(); }
+    /// Get the number of morsels
+    size_t getNumMorsels() const noexcept { return (morselEnd + morselSize - 1) / morselSize; }
 
     /// Produce all tuples
     template <typename LS, typename Consume, typename Prepare, typename Init>
@@ -135,11 +190,35 @@ class TableScan : public ScanImpl<TableScan> {
     std::string_view getTableName() const noexcept;
     std::string getPretty() const override;
     size_t concurrency() const override;
-    /// Create a random sample of size without restrictions (only integer columns)
-    Vector<uint32_t> createUnfilteredSample(size_t sampleSize) const;
+    /// Read the values of a 32 bit column at the sorted row ids, nulls become RuntimeValue::nullValue
+    static void sampleColumn(const ColumnInfo& column, engine::span<const uint64_t> rowIds, uint32_t* values);
+    /// Evaluate the string and 64 bit restrictions on the sorted row ids and clear the bits of the rows that do not match.
+    /// The matches have one bit per row id, the restrictions on 32 bit columns are left to the caller
+    void filterSample(engine::span<const uint64_t> rowIds, uint64_t* matches) const;
 };
 //---------------------------------------------------------------------------
 static_assert(ScanOperator<TableScan>);
 //---------------------------------------------------------------------------
+/// Resolves the row ids of a late materialized column to the actual values
+class LateMaterializer {
+    /// The column
+    const TableScan::ColumnInfo& column;
+    /// The reader
+    UniquePtr<TableScan::Reader> reader;
+    /// The row ids of a batch with their positions, sorted by row id
+    SmallVec<std::pair<uint64_t, uint32_t>> order;
+
+    public:
+    /// Constructor
+    explicit LateMaterializer(const TableScan::ColumnInfo& column);
+    /// Destructor
+    ~LateMaterializer() noexcept;
+
+    /// Create a materializer for the same column, every worker needs its own
+    UniquePtr<LateMaterializer> clone() const;
+    /// Replace the row ids by their values
+    void resolve(uint64_t* values, size_t count);
+};
+//---------------------------------------------------------------------------
 }
 //---------------------------------------------------------------------------
@@ -2,8 +2,10 @@
 #include "infra/PageMemory.hpp"
 #include "infra/QueryMemory.hpp"
 #include "infra/Scheduler.hpp"
+#include "op/TableScan.hpp"
 #include "query/DataSource.hpp"
 #include "storage/StringPtr.hpp"
+#include <algorithm>
 #include <cstdint>
 #include <numeric>
 #include <attribute.h>
@@ -31,6 +33,8 @@ struct Writer {
     virtual void stepBatch(uint64_t* multiplicities, uint64_t* values, size_t count, bool hasNulls) = 0;
     /// Flush collected
     virtual void flush() = 0;
+    /// Start a new page after all pages have been handed out
+    virtual void restart() = 0;
 
     /// Destructor
     virtual ~Writer() noexcept { assert(pages.empty()); }
@@ -136,6 +140,13 @@ struct WriterT : Writer {
         memcpy(pages.back()->getNulls(), nulls.data(), nulls.byteSize());
         nulls.clear();
     }
+    /// Start a new page after all pages have been handed out
+    void restart() override {
+        assert(pages.empty());
+        nulls.clear();
+        next = allocatePage()->template getData<T>();
+        available = CHAR_BIT * (DataSource::PAGE_SIZE - 2 * sizeof(uint16_t) - (sizeof(T) == 8 ? 4 : 0));
+    }
 
     /// Write a value
     void step(uint64_t val) {
@@ -215,6 +226,14 @@ struct WriterT<uint16_t, true> : Writer {
         memcpy(pages.back()->getNulls(), nulls.data(), nulls.byteSize());
         memcpy(pages.back()->getStrings(), strings, stringsSize);
     }
+    /// Start a new page after all pages have been handed out
+    void restart() override {
+        assert(pages.empty());
+        nulls.clear();
+        stringsSize = 0;
+        next = allocatePage()->getData<T>();
+        available = CHAR_BIT * (DataSource::PAGE_SIZE - 2 * sizeof(uint16_t));
+    }
     /// Write a value
     void step(uint64_t val) {
         if (val == nullValue) {
@@ -391,85 +410,202 @@ struct WriterT<uint16_t, true> : Writer {
 };
 }
 //---------------------------------------------------------------------------
-template <typename Allocator>
-static void copyPage(std::vector<Page*, Allocator>& pages, engine::span<DataSource::Page*> source, size_t count, bool moveInitial) {
-    if (count == 0)
-        return;
-    pages.reserve(source.size() * count);
-    if (moveInitial) {
-        for (auto* page : source)
-            pages.push_back(reinterpret_cast<Page*>(page));
-        count--;
+namespace {
+//---------------------------------------------------------------------------
+/// Describes how the pages of an output column are produced
+struct OutputPages {
+    /// The kind of output
+    enum class Kind : uint8_t {
+        /// Move the pages of a writer
+        Move,
+        /// Copy the pages of a writer that was already moved into another column
+        Copy,
+        /// Copy existing pages that we do not own
+        CopyPages,
+        /// Replicate a prototype page of a constant
+        Constant,
+        /// The pages have already been produced
+        Done
+    };
+    /// The kind
+    Kind kind = Kind::Done;
+    /// The writer for Move and Copy
+    unsigned writer = 0;
+    /// The source pages for CopyPages
+    DataSource::Page* const* sourcePages = nullptr;
+    /// The number of full pages for Constant
+    size_t fullPages = 0;
+    /// The full prototype page for Constant
+    DataSource::Page* prototype = nullptr;
+    /// The last partial page for Constant, if any
+    DataSource::Page* tail = nullptr;
+};
+//---------------------------------------------------------------------------
+/// Prepare a constant column. Returns the number of pages that have to be filled
+size_t prepareConstant(OutputPages& output, Column& col, RuntimeValue value, size_t numRows) {
+    auto vv = value.value;
+    if (numRows == 0)
+        return 0;
+
+    auto writer = TableTarget::makeWriter(value.type);
+    if (value.type == DataType::VARCHAR && vv != RuntimeValue::nullValue && StringPtr{vv}.is_long()) [[unlikely]] {
+        // Long strings span multiple pages, there is no single prototype page
+        writer->stepMany(vv, numRows);
+        writer->flush();
+        {
+            pagememory::AllocationStealer stealer;
+            col.pages.reserve(writer->pages.size());
+        }
+        for (auto* page : writer->pages)
+            col.pages.push_back(reinterpret_cast<Page*>(page));
+        writer->pages.clear();
+        return 0;
     }
 
-    for (size_t i = 0; i < count; i++) {
-        for (auto* page : source) {
-            auto* p = pages.emplace_back(new Page);
-            memcpy(p, page, PAGE_SIZE);
+    // Every full page of a constant looks the same. Write until the first page is full and replicate it
+    constexpr size_t probeSize = 1024;
+    size_t written = 0;
+    while (written < numRows && writer->pages.size() < 2) {
+        auto count = std::min(probeSize, numRows - written);
+        writer->stepMany(vv, count);
+        written += count;
+    }
+    if (writer->pages.size() < 2) {
+        writer->flush();
+        output.tail = writer->pages.front();
+    } else {
+        output.prototype = writer->pages.front();
+        size_t rowsPerPage = output.prototype->numRows;
+        output.fullPages = numRows / rowsPerPage;
+        for (size_t i = 1; i < writer->pages.size(); i++)
+            delete writer->pages[i];
+        if (auto rest = numRows % rowsPerPage) {
+            auto tailWriter = TableTarget::makeWriter(value.type);
+            tailWriter->stepMany(vv, rest);
+            tailWriter->flush();
+            assert(tailWriter->pages.size() == 1);
+            output.tail = tailWriter->pages.front();
+            tailWriter->pages.clear();
         }
     }
+    writer->pages.clear();
+    output.kind = OutputPages::Kind::Constant;
+    return output.fullPages + (output.tail != nullptr);
 }
 //---------------------------------------------------------------------------
-ColumnarTable TableTarget::prepareAndExtract(const SmallVec<std::variant<unsigned, RuntimeValue>>& columns) {
+/// Gather, copy, and replicate the pages of all output columns
+template <typename SourcePage>
+void fillPages(ColumnarTable& result, const Vector<OutputPages>& outputs, const Vector<size_t>& columnPageOffsets, SourcePage&& sourcePage, bool parallel) {
+    const size_t totalPages = columnPageOffsets.back();
+    constexpr size_t morselSize = 16;
+    auto fill = [&](size_t, size_t begin) {
+        auto end = std::min(begin + morselSize, totalPages);
+        size_t colIdx = std::upper_bound(columnPageOffsets.begin() + 1, columnPageOffsets.end(), begin) - (columnPageOffsets.begin() + 1);
+        for (size_t pos = begin; pos < end; pos++) {
+            while (pos >= columnPageOffsets[colIdx + 1])
+                colIdx++;
+            auto& output = outputs[colIdx];
+            auto page = pos - columnPageOffsets[colIdx];
+            DataSource::Page* target;
+            switch (output.kind) {
+                case OutputPages::Kind::Move:
+                    target = sourcePage(output.writer, page);
+                    break;
+                case OutputPages::Kind::Copy:
+                    target = static_cast<DataSource::Page*>(pagememory::allocate());
+                    memcpy(target, sourcePage(output.writer, page), DataSource::PAGE_SIZE);
+                    break;
+                case OutputPages::Kind::CopyPages:
+                    target = static_cast<DataSource::Page*>(pagememory::allocate());
+                    memcpy(target, output.sourcePages[page], DataSource::PAGE_SIZE);
+                    break;
+                case OutputPages::Kind::Constant:
+                    if (page >= output.fullPages) {
+                        target = output.tail;
+                    } else if (page == 0) {
+                        target = output.prototype;
+                    } else {
+                        target = static_cast<DataSource::Page*>(pagememory::allocate());
+                        memcpy(target, output.prototype, DataSource::PAGE_SIZE);
+                    }
+                    break;
+                case OutputPages::Kind::Done: __builtin_unreachable();
+            }
+            result.columns[colIdx].pages[page] = reinterpret_cast<Page*>(target);
+        }
+    };
+    if (parallel) {
+        Scheduler::parallelMorsel(0, totalPages, morselSize, fill);
+    } else {
+        for (size_t begin = 0; begin < totalPages; begin += morselSize)
+            fill(0, begin);
+    }
+}
+//---------------------------------------------------------------------------
+}
+//---------------------------------------------------------------------------
+/// Build the output columns from the pages collected by the local states and clear their writers
+static ColumnarTable extractColumns(engine::span<TableTarget::LocalState* const> localStates, const SmallVec<DataType>& types, size_t numRows, const SmallVec<std::variant<unsigned, RuntimeValue>>& columns, bool parallel) {
     ColumnarTable result;
     {
         pagememory::AllocationStealer stealer;
         result.columns.reserve(columns.size());
     }
-    result.num_rows = std::accumulate(localStates.begin(), localStates.end(), 0ul,
-                                      [](const size_t acc, const auto& state) { return acc + state->numRows; });
-    SmallVec<unsigned> writerUsed(localStates.front()->writers.size(), ~0u);
+    result.num_rows = numRows;
+
+    // The page prefix sums of every writer over all local states
+    const size_t numWriters = localStates.front()->writers.size();
+    const size_t stride = localStates.size() + 1;
+    Vector<size_t> statePageOffsets(numWriters * stride);
+    for (size_t idx = 0; idx < numWriters; idx++) {
+        auto* offsets = statePageOffsets.data() + idx * stride;
+        offsets[0] = 0;
+        for (size_t i = 0; i < localStates.size(); i++)
+            offsets[i + 1] = offsets[i] + localStates[i]->writers[idx]->pages.size();
+    }
+    auto sourcePage = [&](unsigned idx, size_t page) {
+        auto* offsets = statePageOffsets.data() + idx * stride;
+        size_t state = std::upper_bound(offsets + 1, offsets + stride, page) - (offsets + 1);
+        return localStates[state]->writers[idx]->pages[page - offsets[state]];
+    };
+
+    // Decide how to produce every output column. The page copies are deferred to fillPages
+    Vector<OutputPages> outputs(columns.size());
+    Vector<size_t> columnPageOffsets(columns.size() + 1);
+    columnPageOffsets[0] = 0;
+    SmallVec<unsigned> writerUsed(numWriters, ~0u);
     for (size_t colIdx = 0; colIdx < columns.size(); colIdx++) {
         auto& column = columns[colIdx];
+        auto& output = outputs[colIdx];
+        size_t pageCount;
         if (std::holds_alternative<unsigned>(column)) {
             const auto idx = get<unsigned>(column);
-            auto& col = result.columns.emplace_back(types[idx]);
-            size_t totCount = 0;
-            for (auto& state : localStates)
-                totCount += state->writers[idx]->pages.size();
-            // Unfortunately, it seems std::malloc can be arbitrarily slow
-            // So we steal allocations here
-            {
-                pagememory::AllocationStealer stealer;
-                col.pages.reserve(totCount);
-            }
-
-            // we can put the pages into multiple output columns WITHOUT a copy
-            // the only potential problem might be a "double-free" on the page, but as
-            // we catch those cases and make them a nop anyways, there is no problem with that
-            // (we only also have to convince the address sanitizer...)
-            bool used = writerUsed[idx] != ~0u;
-            if (!used) {
-                for (auto& state : localStates) {
-                    for (auto* page : state->writers[idx]->pages)
-                        col.pages.push_back(reinterpret_cast<Page*>(page));
-                }
-                writerUsed[idx] = colIdx;
-            } else {
-                auto& srcCol = result.columns[writerUsed[idx]].pages;
-                copyPage(col.pages, engine::span{reinterpret_cast<DataSource::Page**>(srcCol.data()), srcCol.size()}, 1, false);
-            }
+            result.columns.emplace_back(types[idx]);
+            // The first use of a writer takes its pages, all further uses get a copy
+            output.kind = writerUsed[idx] == ~0u ? OutputPages::Kind::Move : OutputPages::Kind::Copy;
+            output.writer = idx;
+            writerUsed[idx] = colIdx;
+            pageCount = statePageOffsets[idx * stride + localStates.size()];
         } else {
             auto value = get<RuntimeValue>(column);
             auto& col = result.columns.emplace_back(value.type);
-            auto vv = value.value;
-
-            if (result.num_rows == 0) continue;
-
-            auto writer = makeWriter(value.type);
-
-            writer->stepMany(vv, result.num_rows);
-            writer->flush();
-            {
-                pagememory::AllocationStealer stealer;
-                col.pages.reserve(writer->pages.size());
+            pageCount = prepareConstant(output, col, value, numRows);
+            if (!pageCount) {
+                columnPageOffsets[colIdx + 1] = columnPageOffsets[colIdx];
+                continue;
             }
-            for (auto* page : writer->pages)
-                col.pages.push_back(reinterpret_cast<Page*>(page));
-            writer->pages.clear();
+        }
+        columnPageOffsets[colIdx + 1] = columnPageOffsets[colIdx] + pageCount;
+        // Unfortunately, it seems std::malloc can be arbitrarily slow
+        // So we steal allocations here
+        {
+            pagememory::AllocationStealer stealer;
+            result.columns.back().pages.resize(pageCount);
         }
     }
 
+    fillPages(result, outputs, columnPageOffsets, sourcePage, parallel);
+
     // Clear the writers
     for (size_t idx = 0; idx < writerUsed.size(); idx++) {
         if (writerUsed[idx] == ~0u) {
@@ -489,6 +625,50 @@ ColumnarTable TableTarget::prepareAndExtract(const SmallVec<std::variant<unsigne
     return result;
 }
 //---------------------------------------------------------------------------
+ColumnarTable TableTarget::prepareAndExtract(const SmallVec<std::variant<unsigned, RuntimeValue>>& columns) {
+    auto numRows = std::accumulate(localStates.begin(), localStates.end(), 0ul,
+                                   [](const size_t acc, const auto& state) { return acc + state->numRows; });
+    return extractColumns({localStates.data(), localStates.size()}, types, numRows, columns, true);
+}
+//---------------------------------------------------------------------------
+ColumnarTable TableTarget::passThrough(const SmallVec<SourceColumn>& sources, size_t numRows, const SmallVec<std::variant<unsigned, RuntimeValue>>& columns) {
+    ColumnarTable result;
+    {
+        pagememory::AllocationStealer stealer;
+        result.columns.reserve(columns.size());
+    }
+    result.num_rows = numRows;
+
+    Vector<OutputPages> outputs(columns.size());
+    Vector<size_t> columnPageOffsets(columns.size() + 1);
+    columnPageOffsets[0] = 0;
+    for (size_t colIdx = 0; colIdx < columns.size(); colIdx++) {
+        auto& column = columns[colIdx];
+        auto& output = outputs[colIdx];
+        size_t pageCount;
+        if (std::holds_alternative<unsigned>(column)) {
+            // We do not own the source pages, so they have to be copied
+            auto& source = sources[get<unsigned>(column)];
+            result.columns.emplace_back(source.type);
+            output.kind = OutputPages::Kind::CopyPages;
+            output.sourcePages = source.pages.data();
+            pageCount = source.pages.size();
+        } else {
+            auto value = get<RuntimeValue>(column);
+            auto& col = result.columns.emplace_back(value.type);
+            pageCount = prepareConstant(output, col, value, numRows);
+        }
+        columnPageOffsets[colIdx + 1] = columnPageOffsets[colIdx] + pageCount;
+        if (pageCount) {
+            pagememory::AllocationStealer stealer;
+            result.columns.back().pages.resize(pageCount);
+        }
+    }
+
+    fillPages(result, outputs, columnPageOffsets, [](unsigned, size_t) -> DataSource::Page* { __builtin_unreachable(); }, true);
+    return result;
+}
+//---------------------------------------------------------------------------
 ColumnarTable TableTarget::extract() {
     ColumnarTable result;
     result.num_rows = std::accumulate(localStates.begin(), localStates.end(), 0ul,
@@ -531,9 +711,11 @@ UniquePtr<impl::Writer> TableTarget::makeWriter(DataType type) {
     __builtin_unreachable();
 }
 //---------------------------------------------------------------------------
-TableTarget::LocalState::LocalState(TableTarget& target) {
+TableTarget::LocalState::LocalState(TableTarget& target) : target(&target) {
     for (auto type : target.types)
         writers.emplace_back(makeWriter(type));
+    for (auto& [column, materializer] : target.lateColumns)
+        materializers.emplace_back(column, materializer->clone());
     // The first column is multiplicity
     buffer = static_cast<uint64_t*>(querymemory::allocate(sizeof(uint64_t) * bufferCount * (config::handleMultiplicity + writers.size())));
     curBuffer = buffer;
@@ -558,10 +740,19 @@ void TableTarget::finishConsume() {
 //---------------------------------------------------------------------------
 void TableTarget::finalize(LocalState& state) const {
     state.flushBuffers();
+    if (sink) {
+        state.emitChunk(true);
+        return;
+    }
     for (auto& writer : state.writers)
         writer->flush();
 }
 //---------------------------------------------------------------------------
+void TableTarget::setSink(FunctionRef<void(ColumnarTable&)> sink, SmallVec<std::variant<unsigned, RuntimeValue>> columns) {
+    this->sink = sink;
+    sinkColumns = std::move(columns);
+}
+//---------------------------------------------------------------------------
 void TableTarget::LocalState::flushBuffers() {
     auto numRowsBuffer = (curBuffer - buffer);
     if (!numRowsBuffer)
@@ -574,12 +765,43 @@ void TableTarget::LocalState::flushBuffers() {
     } else {
         numRows += numRowsBuffer;
     }
+    for (auto& [column, materializer] : materializers) {
+        materializer->resolve(buffer + (column + config::handleMultiplicity) * bufferCount, numRowsBuffer);
+        hasNulls |= 1u << column;
+    }
     for (size_t i = 0; i < writers.size(); i++) {
         auto* st = buffer + (i + config::handleMultiplicity) * bufferCount;
         writers[i]->stepBatch(buffer, st, numRowsBuffer, hasNulls & (1u << i));
     }
     curBuffer = buffer;
     hasNulls = 0;
+    if (target->sink && numRows - emittedRows >= chunkRows) [[unlikely]]
+        emitChunk(false);
+}
+//---------------------------------------------------------------------------
+void TableTarget::LocalState::emitChunk(bool last) {
+    if (numRows == emittedRows) {
+        // Nothing to emit, just drop the empty pages
+        if (!last)
+            return;
+        for (auto& writer : writers) {
+            for (auto* page : writer->pages)
+                delete page;
+            writer->pages.clear();
+        }
+        return;
+    }
+    for (auto& writer : writers)
+        writer->flush();
+    // We are running within a pipeline, so the chunk is built by the current worker alone
+    LocalState* self = this;
+    auto chunk = extractColumns({&self, 1}, target->types, numRows - emittedRows, target->sinkColumns, false);
+    emittedRows = numRows;
+    if (!last) {
+        for (auto& writer : writers)
+            writer->restart();
+    }
+    target->sink(chunk);
 }
 //---------------------------------------------------------------------------
 std::string TableTarget::getPretty() const {
@@ -23,6 +23,7 @@ namespace engine {
 namespace impl {
 class Writer;
 }
+class LateMaterializer;
 //---------------------------------------------------------------------------
 class TableTarget : public TargetImpl<TableTarget> {
     public:
@@ -37,6 +38,8 @@ class TableTarget : public TargetImpl<TableTarget> {
         size_t numRows = 0;
         /// The column writers
         SmallVec<UniquePtr<impl::Writer>> writers;
+        /// The materializers for columns that contain row ids
+        SmallVec<std::pair<unsigned, UniquePtr<LateMaterializer>>> materializers;
         /// The output buffer
         uint64_t* buffer;
         /// indicating whether the current batch has nulls
@@ -44,6 +47,10 @@ class TableTarget : public TargetImpl<TableTarget> {
         uint32_t hasNulls = 0;
         /// The next state
         LocalState* next = nullptr;
+        /// The target
+        TableTarget* target;
+        /// The number of rows that were already passed to the sink
+        size_t emittedRows = 0;
 
         LocalState(TableTarget& target);
         ~LocalState() noexcept;
@@ -51,11 +58,21 @@ class TableTarget : public TargetImpl<TableTarget> {
         LocalState& operator=(LocalState&&) noexcept;
 
         void flushBuffers();
+        /// Pass the rows collected since the last chunk to the sink
+        void emitChunk(bool last);
     };
     std::atomic<LocalState*> localStateRefs = nullptr;
     Vector<LocalState*> localStates;
     /// The data types
     SmallVec<DataType> types;
+    /// The columns that contain row ids and have to be materialized. Must be set before creating local states
+    SmallVec<std::pair<unsigned, UniquePtr<LateMaterializer>>> lateColumns;
+    /// The optional sink that receives the result in chunks while the pipeline is running
+    FunctionRef<void(ColumnarTable&)> sink;
+    /// The output columns of the chunks passed to the sink
+    SmallVec<std::variant<unsigned, RuntimeValue>> sinkColumns;
+    /// The number of rows after which a local state passes a chunk to the sink
+    static constexpr size_t chunkRows = 1ull << 16;
 
     /// Make a writer given type
     static UniquePtr<impl::Writer> makeWriter(DataType type);
@@ -83,6 +100,20 @@ class TableTarget : public TargetImpl<TableTarget> {
         if (ls.curBuffer == ls.endBuffer)
             ls.flushBuffers();
     }
+    /// Consume attributes whose number is only known at runtime
+    void consumeTuple(LocalState& ls, uint64_t multiplicity, const uint64_t* attrs) {
+        auto* cur = ls.curBuffer;
+        if constexpr (config::handleMultiplicity) {
+            (*cur = multiplicity, cur += LocalState::bufferCount);
+        }
+        for (unsigned ind = 0; ind < ls.writers.size(); ind++, cur += LocalState::bufferCount) {
+            *cur = attrs[ind];
+            ls.hasNulls |= (attrs[ind] == RuntimeValue::nullValue) << ind;
+        }
+        ls.curBuffer++;
+        if (ls.curBuffer == ls.endBuffer)
+            ls.flushBuffers();
+    }
 
     /// Flush collected
     void finishConsume();
@@ -95,6 +126,19 @@ class TableTarget : public TargetImpl<TableTarget> {
     ColumnarTable prepareAndExtract(const SmallVec<std::variant<unsigned, RuntimeValue>>& columns);
     /// Extract the result
     ColumnarTable extract();
+    /// An existing column that is passed through to the output
+    struct SourceColumn {
+        /// The data type
+        DataType type;
+        /// The pages
+        engine::span<DataSource::Page* const> pages;
+    };
+    /// Build the output from existing columns without running a pipeline.
+    /// An output column is either an index into sources, whose pages are copied, or a constant.
+    static ColumnarTable passThrough(const SmallVec<SourceColumn>& sources, size_t numRows, const SmallVec<std::variant<unsigned, RuntimeValue>>& columns);
+    /// Stream the result to a sink instead of collecting it.
+    /// The sink may be called concurrently by all workers, each chunk holds the given output columns.
+    void setSink(FunctionRef<void(ColumnarTable&)> sink, SmallVec<std::variant<unsigned, RuntimeValue>> columns);
 
     std::string getPretty() const override;
 };
@@ -10,6 +10,7 @@
 //---------------------------------------------------------------------------
 namespace engine {
 //---------------------------------------------------------------------------
+struct DistinctTarget;
 class Hashtable;
 class HashtableBuild;
 class HashtableProbe;
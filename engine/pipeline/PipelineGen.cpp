@@ -1,7 +1,578 @@
 #include "pipeline/PipelineFunction.hpp"
 namespace engine {
-size_t PipelineFunctions::numFunctions = 1138;
+size_t PipelineFunctions::numFunctions = 1709;
 std::pair<std::string_view, PipelineFunction> PipelineFunctions::functions[] = {
+{std::string_view{"engine::DistinctTarget,engine::TableScan,0,(),()"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 0, std::index_sequence<>, std::index_sequence<>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,0,(),(0)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 0, std::index_sequence<>, std::index_sequence<0>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,0,(),(00)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 0, std::index_sequence<>, std::index_sequence<0,0>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,0,(),(000)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 0, std::index_sequence<>, std::index_sequence<0,0,0>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,0,(),(0000)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 0, std::index_sequence<>, std::index_sequence<0,0,0,0>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,0,(),(00000)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 0, std::index_sequence<>, std::index_sequence<0,0,0,0,0>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,0,(),(000000)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 0, std::index_sequence<>, std::index_sequence<0,0,0,0,0,0>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,0,(),(0000000)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 0, std::index_sequence<>, std::index_sequence<0,0,0,0,0,0,0>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,1,(0),()"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 1, std::index_sequence<0>, std::index_sequence<>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,1,(0),(0)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 1, std::index_sequence<0>, std::index_sequence<0>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,1,(0),(00)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 1, std::index_sequence<0>, std::index_sequence<0,0>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,1,(0),(000)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 1, std::index_sequence<0>, std::index_sequence<0,0,0>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,1,(0),(0000)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 1, std::index_sequence<0>, std::index_sequence<0,0,0,0>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,1,(0),(00000)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 1, std::index_sequence<0>, std::index_sequence<0,0,0,0,0>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,1,(0),(000000)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 1, std::index_sequence<0>, std::index_sequence<0,0,0,0,0,0>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,1,(0),(0000000)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 1, std::index_sequence<0>, std::index_sequence<0,0,0,0,0,0,0>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,1,(0),(0000001)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 1, std::index_sequence<0>, std::index_sequence<0,0,0,0,0,0,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,1,(0),(000001)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 1, std::index_sequence<0>, std::index_sequence<0,0,0,0,0,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,1,(0),(0000011)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 1, std::index_sequence<0>, std::index_sequence<0,0,0,0,0,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,1,(0),(00001)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 1, std::index_sequence<0>, std::index_sequence<0,0,0,0,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,1,(0),(000011)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 1, std::index_sequence<0>, std::index_sequence<0,0,0,0,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,1,(0),(0000111)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 1, std::index_sequence<0>, std::index_sequence<0,0,0,0,1,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,1,(0),(0001)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 1, std::index_sequence<0>, std::index_sequence<0,0,0,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,1,(0),(00011)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 1, std::index_sequence<0>, std::index_sequence<0,0,0,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,1,(0),(000111)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 1, std::index_sequence<0>, std::index_sequence<0,0,0,1,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,1,(0),(0001111)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 1, std::index_sequence<0>, std::index_sequence<0,0,0,1,1,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,1,(0),(001)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 1, std::index_sequence<0>, std::index_sequence<0,0,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,1,(0),(0011)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 1, std::index_sequence<0>, std::index_sequence<0,0,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,1,(0),(00111)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 1, std::index_sequence<0>, std::index_sequence<0,0,1,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,1,(0),(001111)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 1, std::index_sequence<0>, std::index_sequence<0,0,1,1,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,1,(0),(0011111)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 1, std::index_sequence<0>, std::index_sequence<0,0,1,1,1,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,1,(0),(01)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 1, std::index_sequence<0>, std::index_sequence<0,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,1,(0),(011)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 1, std::index_sequence<0>, std::index_sequence<0,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,1,(0),(0111)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 1, std::index_sequence<0>, std::index_sequence<0,1,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,1,(0),(01111)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 1, std::index_sequence<0>, std::index_sequence<0,1,1,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,1,(0),(011111)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 1, std::index_sequence<0>, std::index_sequence<0,1,1,1,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,1,(0),(0111111)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 1, std::index_sequence<0>, std::index_sequence<0,1,1,1,1,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,1,(0),(1)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 1, std::index_sequence<0>, std::index_sequence<1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,1,(0),(10)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 1, std::index_sequence<0>, std::index_sequence<1,0>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,1,(0),(100)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 1, std::index_sequence<0>, std::index_sequence<1,0,0>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,1,(0),(1000)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 1, std::index_sequence<0>, std::index_sequence<1,0,0,0>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,1,(0),(10000)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 1, std::index_sequence<0>, std::index_sequence<1,0,0,0,0>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,1,(0),(100000)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 1, std::index_sequence<0>, std::index_sequence<1,0,0,0,0,0>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,1,(0),(1000000)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 1, std::index_sequence<0>, std::index_sequence<1,0,0,0,0,0,0>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,1,(0),(1000001)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 1, std::index_sequence<0>, std::index_sequence<1,0,0,0,0,0,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,1,(0),(100001)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 1, std::index_sequence<0>, std::index_sequence<1,0,0,0,0,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,1,(0),(1000011)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 1, std::index_sequence<0>, std::index_sequence<1,0,0,0,0,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,1,(0),(10001)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 1, std::index_sequence<0>, std::index_sequence<1,0,0,0,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,1,(0),(100011)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 1, std::index_sequence<0>, std::index_sequence<1,0,0,0,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,1,(0),(1000111)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 1, std::index_sequence<0>, std::index_sequence<1,0,0,0,1,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,1,(0),(1001)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 1, std::index_sequence<0>, std::index_sequence<1,0,0,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,1,(0),(10011)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 1, std::index_sequence<0>, std::index_sequence<1,0,0,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,1,(0),(100111)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 1, std::index_sequence<0>, std::index_sequence<1,0,0,1,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,1,(0),(1001111)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 1, std::index_sequence<0>, std::index_sequence<1,0,0,1,1,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,1,(0),(101)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 1, std::index_sequence<0>, std::index_sequence<1,0,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,1,(0),(1011)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 1, std::index_sequence<0>, std::index_sequence<1,0,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,1,(0),(10111)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 1, std::index_sequence<0>, std::index_sequence<1,0,1,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,1,(0),(101111)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 1, std::index_sequence<0>, std::index_sequence<1,0,1,1,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,1,(0),(1011111)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 1, std::index_sequence<0>, std::index_sequence<1,0,1,1,1,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,1,(0),(11)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 1, std::index_sequence<0>, std::index_sequence<1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,1,(0),(111)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 1, std::index_sequence<0>, std::index_sequence<1,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,1,(0),(1111)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 1, std::index_sequence<0>, std::index_sequence<1,1,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,1,(0),(11111)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 1, std::index_sequence<0>, std::index_sequence<1,1,1,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,1,(0),(111111)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 1, std::index_sequence<0>, std::index_sequence<1,1,1,1,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,1,(0),(1111111)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 1, std::index_sequence<0>, std::index_sequence<1,1,1,1,1,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),()"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(0)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(00)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(000)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,0>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(0000)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,0,0>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(00000)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,0,0,0>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(000000)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,0,0,0,0>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(0000000)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,0,0,0,0,0>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(0000001)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,0,0,0,0,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(0000002)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,0,0,0,0,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(000001)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,0,0,0,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(0000011)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,0,0,0,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(0000012)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,0,0,0,1,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(000002)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,0,0,0,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(0000022)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,0,0,0,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(00001)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,0,0,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(000011)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,0,0,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(0000111)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,0,0,1,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(0000112)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,0,0,1,1,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(000012)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,0,0,1,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(0000122)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,0,0,1,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(00002)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,0,0,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(000022)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,0,0,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(0000222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,0,0,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(0001)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,0,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(00011)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,0,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(000111)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,0,1,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(0001111)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,0,1,1,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(0001112)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,0,1,1,1,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(000112)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,0,1,1,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(0001122)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,0,1,1,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(00012)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,0,1,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(000122)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,0,1,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(0001222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,0,1,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(0002)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,0,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(00022)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,0,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(000222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,0,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(0002222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,0,2,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(001)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(0011)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(00111)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,1,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(001111)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,1,1,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(0011111)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,1,1,1,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(0011112)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,1,1,1,1,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(001112)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,1,1,1,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(0011122)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,1,1,1,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(00112)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,1,1,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(001122)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,1,1,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(0011222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,1,1,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(0012)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,1,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(00122)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,1,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(001222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,1,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(0012222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,1,2,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(002)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(0022)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(00222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(002222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,2,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(0022222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,2,2,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(01)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(011)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(0111)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,1,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(01111)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,1,1,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(011111)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,1,1,1,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(0111111)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,1,1,1,1,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(0111112)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,1,1,1,1,1,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(011112)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,1,1,1,1,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(0111122)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,1,1,1,1,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(01112)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,1,1,1,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(011122)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,1,1,1,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(0111222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,1,1,1,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(0112)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,1,1,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(01122)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,1,1,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(011222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,1,1,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(0112222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,1,1,2,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(012)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,1,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(0122)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,1,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(01222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,1,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(012222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,1,2,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(0122222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,1,2,2,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(02)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(022)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(0222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(02222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,2,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(022222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,2,2,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(0222222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,2,2,2,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(1)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(10)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<1,0>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(100)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<1,0,0>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(1000)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<1,0,0,0>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(10000)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<1,0,0,0,0>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(100000)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<1,0,0,0,0,0>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(1000000)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<1,0,0,0,0,0,0>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(1000001)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<1,0,0,0,0,0,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(1000002)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<1,0,0,0,0,0,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(100001)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<1,0,0,0,0,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(1000011)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<1,0,0,0,0,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(1000012)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<1,0,0,0,0,1,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(100002)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<1,0,0,0,0,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(1000022)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<1,0,0,0,0,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(10001)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<1,0,0,0,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(100011)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<1,0,0,0,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(1000111)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<1,0,0,0,1,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(1000112)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<1,0,0,0,1,1,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(100012)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<1,0,0,0,1,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(1000122)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<1,0,0,0,1,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(10002)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<1,0,0,0,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(100022)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<1,0,0,0,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(1000222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<1,0,0,0,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(1001)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<1,0,0,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(10011)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<1,0,0,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(100111)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<1,0,0,1,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(1001111)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<1,0,0,1,1,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(1001112)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<1,0,0,1,1,1,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(100112)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<1,0,0,1,1,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(1001122)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<1,0,0,1,1,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(10012)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<1,0,0,1,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(100122)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<1,0,0,1,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(1001222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<1,0,0,1,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(1002)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<1,0,0,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(10022)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<1,0,0,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(100222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<1,0,0,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(1002222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<1,0,0,2,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(101)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<1,0,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(1011)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<1,0,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(10111)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<1,0,1,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(101111)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<1,0,1,1,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(1011111)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<1,0,1,1,1,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(1011112)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<1,0,1,1,1,1,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(101112)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<1,0,1,1,1,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(1011122)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<1,0,1,1,1,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(10112)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<1,0,1,1,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(101122)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<1,0,1,1,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(1011222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<1,0,1,1,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(1012)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<1,0,1,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(10122)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<1,0,1,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(101222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<1,0,1,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(1012222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<1,0,1,2,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(102)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<1,0,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(1022)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<1,0,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(10222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<1,0,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(102222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<1,0,2,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(1022222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<1,0,2,2,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(11)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(111)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<1,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(1111)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<1,1,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(11111)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<1,1,1,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(111111)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<1,1,1,1,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(1111111)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<1,1,1,1,1,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(1111112)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<1,1,1,1,1,1,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(111112)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<1,1,1,1,1,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(1111122)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<1,1,1,1,1,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(11112)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<1,1,1,1,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(111122)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<1,1,1,1,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(1111222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<1,1,1,1,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(1112)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<1,1,1,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(11122)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<1,1,1,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(111222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<1,1,1,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(1112222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<1,1,1,2,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(112)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<1,1,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(1122)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<1,1,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(11222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<1,1,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(112222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<1,1,2,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(1122222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<1,1,2,2,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(12)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<1,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(122)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<1,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(1222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<1,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(12222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<1,2,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(122222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<1,2,2,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(1222222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<1,2,2,2,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(2)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(20)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(200)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,0>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(2000)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,0,0>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(20000)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,0,0,0>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(200000)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,0,0,0,0>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(2000000)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,0,0,0,0,0>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(2000001)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,0,0,0,0,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(2000002)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,0,0,0,0,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(200001)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,0,0,0,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(2000011)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,0,0,0,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(2000012)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,0,0,0,1,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(200002)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,0,0,0,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(2000022)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,0,0,0,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(20001)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,0,0,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(200011)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,0,0,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(2000111)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,0,0,1,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(2000112)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,0,0,1,1,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(200012)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,0,0,1,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(2000122)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,0,0,1,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(20002)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,0,0,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(200022)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,0,0,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(2000222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,0,0,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(2001)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,0,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(20011)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,0,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(200111)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,0,1,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(2001111)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,0,1,1,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(2001112)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,0,1,1,1,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(200112)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,0,1,1,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(2001122)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,0,1,1,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(20012)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,0,1,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(200122)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,0,1,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(2001222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,0,1,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(2002)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,0,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(20022)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,0,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(200222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,0,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(2002222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,0,2,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(201)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(2011)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(20111)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,1,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(201111)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,1,1,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(2011111)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,1,1,1,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(2011112)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,1,1,1,1,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(201112)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,1,1,1,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(2011122)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,1,1,1,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(20112)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,1,1,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(201122)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,1,1,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(2011222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,1,1,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(2012)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,1,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(20122)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,1,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(201222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,1,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(2012222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,1,2,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(202)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(2022)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(20222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(202222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,2,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(2022222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,2,2,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(21)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(211)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(2111)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,1,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(21111)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,1,1,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(211111)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,1,1,1,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(2111111)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,1,1,1,1,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(2111112)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,1,1,1,1,1,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(211112)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,1,1,1,1,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(2111122)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,1,1,1,1,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(21112)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,1,1,1,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(211122)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,1,1,1,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(2111222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,1,1,1,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(2112)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,1,1,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(21122)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,1,1,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(211222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,1,1,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(2112222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,1,1,2,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(212)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,1,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(2122)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,1,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(21222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,1,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(212222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,1,2,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(2122222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,1,2,2,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(22)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(2222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(22222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,2,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(222222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,2,2,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(00),(2222222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,2,2,2,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),()"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(0)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<0>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(00)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<0,0>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(000)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<0,0,0>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(0000)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<0,0,0,0>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(00000)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<0,0,0,0,0>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(000000)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<0,0,0,0,0,0>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(0000000)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<0,0,0,0,0,0,0>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(0000001)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<0,0,0,0,0,0,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(0000002)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<0,0,0,0,0,0,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(000001)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<0,0,0,0,0,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(0000011)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<0,0,0,0,0,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(0000012)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<0,0,0,0,0,1,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(000002)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<0,0,0,0,0,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(0000022)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<0,0,0,0,0,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(00001)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<0,0,0,0,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(000011)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<0,0,0,0,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(0000111)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<0,0,0,0,1,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(0000112)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<0,0,0,0,1,1,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(000012)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<0,0,0,0,1,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(0000122)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<0,0,0,0,1,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(00002)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<0,0,0,0,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(000022)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<0,0,0,0,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(0000222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<0,0,0,0,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(0001)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<0,0,0,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(00011)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<0,0,0,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(000111)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<0,0,0,1,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(0001111)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<0,0,0,1,1,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(0001112)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<0,0,0,1,1,1,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(000112)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<0,0,0,1,1,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(0001122)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<0,0,0,1,1,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(00012)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<0,0,0,1,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(000122)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<0,0,0,1,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(0001222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<0,0,0,1,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(0002)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<0,0,0,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(00022)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<0,0,0,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(000222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<0,0,0,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(0002222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<0,0,0,2,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(001)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<0,0,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(0011)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<0,0,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(00111)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<0,0,1,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(001111)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<0,0,1,1,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(0011111)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<0,0,1,1,1,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(0011112)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<0,0,1,1,1,1,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(001112)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<0,0,1,1,1,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(0011122)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<0,0,1,1,1,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(00112)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<0,0,1,1,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(001122)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<0,0,1,1,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(0011222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<0,0,1,1,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(0012)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<0,0,1,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(00122)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<0,0,1,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(001222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<0,0,1,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(0012222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<0,0,1,2,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(002)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<0,0,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(0022)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<0,0,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(00222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<0,0,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(002222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<0,0,2,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(0022222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<0,0,2,2,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(01)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<0,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(011)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<0,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(0111)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<0,1,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(01111)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<0,1,1,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(011111)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<0,1,1,1,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(0111111)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<0,1,1,1,1,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(0111112)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<0,1,1,1,1,1,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(011112)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<0,1,1,1,1,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(0111122)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<0,1,1,1,1,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(01112)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<0,1,1,1,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(011122)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<0,1,1,1,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(0111222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<0,1,1,1,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(0112)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<0,1,1,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(01122)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<0,1,1,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(011222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<0,1,1,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(0112222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<0,1,1,2,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(012)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<0,1,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(0122)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<0,1,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(01222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<0,1,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(012222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<0,1,2,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(0122222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<0,1,2,2,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(02)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<0,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(022)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<0,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(0222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<0,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(02222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<0,2,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(022222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<0,2,2,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(0222222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<0,2,2,2,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(1)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(10)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<1,0>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(100)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<1,0,0>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(1000)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<1,0,0,0>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(10000)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<1,0,0,0,0>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(100000)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<1,0,0,0,0,0>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(1000000)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<1,0,0,0,0,0,0>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(1000001)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<1,0,0,0,0,0,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(1000002)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<1,0,0,0,0,0,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(100001)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<1,0,0,0,0,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(1000011)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<1,0,0,0,0,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(1000012)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<1,0,0,0,0,1,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(100002)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<1,0,0,0,0,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(1000022)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<1,0,0,0,0,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(10001)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<1,0,0,0,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(100011)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<1,0,0,0,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(1000111)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<1,0,0,0,1,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(1000112)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<1,0,0,0,1,1,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(100012)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<1,0,0,0,1,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(1000122)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<1,0,0,0,1,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(10002)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<1,0,0,0,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(100022)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<1,0,0,0,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(1000222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<1,0,0,0,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(1001)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<1,0,0,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(10011)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<1,0,0,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(100111)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<1,0,0,1,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(1001111)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<1,0,0,1,1,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(1001112)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<1,0,0,1,1,1,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(100112)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<1,0,0,1,1,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(1001122)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<1,0,0,1,1,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(10012)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<1,0,0,1,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(100122)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<1,0,0,1,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(1001222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<1,0,0,1,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(1002)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<1,0,0,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(10022)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<1,0,0,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(100222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<1,0,0,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(1002222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<1,0,0,2,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(101)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<1,0,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(1011)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<1,0,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(10111)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<1,0,1,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(101111)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<1,0,1,1,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(1011111)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<1,0,1,1,1,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(1011112)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<1,0,1,1,1,1,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(101112)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<1,0,1,1,1,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(1011122)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<1,0,1,1,1,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(10112)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<1,0,1,1,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(101122)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<1,0,1,1,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(1011222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<1,0,1,1,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(1012)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<1,0,1,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(10122)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<1,0,1,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(101222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<1,0,1,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(1012222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<1,0,1,2,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(102)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<1,0,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(1022)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<1,0,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(10222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<1,0,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(102222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<1,0,2,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(1022222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<1,0,2,2,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(11)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(111)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<1,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(1111)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<1,1,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(11111)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<1,1,1,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(111111)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<1,1,1,1,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(1111111)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<1,1,1,1,1,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(1111112)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<1,1,1,1,1,1,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(111112)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<1,1,1,1,1,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(1111122)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<1,1,1,1,1,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(11112)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<1,1,1,1,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(111122)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<1,1,1,1,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(1111222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<1,1,1,1,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(1112)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<1,1,1,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(11122)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<1,1,1,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(111222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<1,1,1,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(1112222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<1,1,1,2,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(112)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<1,1,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(1122)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<1,1,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(11222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<1,1,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(112222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<1,1,2,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(1122222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<1,1,2,2,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(12)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<1,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(122)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<1,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(1222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<1,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(12222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<1,2,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(122222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<1,2,2,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(1222222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<1,2,2,2,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(2)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(20)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<2,0>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(200)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<2,0,0>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(2000)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<2,0,0,0>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(20000)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<2,0,0,0,0>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(200000)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<2,0,0,0,0,0>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(2000000)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<2,0,0,0,0,0,0>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(2000001)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<2,0,0,0,0,0,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(2000002)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<2,0,0,0,0,0,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(200001)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<2,0,0,0,0,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(2000011)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<2,0,0,0,0,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(2000012)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<2,0,0,0,0,1,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(200002)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<2,0,0,0,0,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(2000022)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<2,0,0,0,0,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(20001)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<2,0,0,0,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(200011)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<2,0,0,0,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(2000111)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<2,0,0,0,1,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(2000112)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<2,0,0,0,1,1,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(200012)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<2,0,0,0,1,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(2000122)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<2,0,0,0,1,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(20002)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<2,0,0,0,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(200022)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<2,0,0,0,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(2000222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<2,0,0,0,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(2001)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<2,0,0,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(20011)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<2,0,0,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(200111)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<2,0,0,1,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(2001111)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<2,0,0,1,1,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(2001112)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<2,0,0,1,1,1,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(200112)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<2,0,0,1,1,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(2001122)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<2,0,0,1,1,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(20012)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<2,0,0,1,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(200122)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<2,0,0,1,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(2001222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<2,0,0,1,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(2002)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<2,0,0,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(20022)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<2,0,0,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(200222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<2,0,0,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(2002222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<2,0,0,2,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(201)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<2,0,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(2011)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<2,0,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(20111)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<2,0,1,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(201111)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<2,0,1,1,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(2011111)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<2,0,1,1,1,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(2011112)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<2,0,1,1,1,1,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(201112)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<2,0,1,1,1,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(2011122)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<2,0,1,1,1,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(20112)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<2,0,1,1,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(201122)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<2,0,1,1,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(2011222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<2,0,1,1,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(2012)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<2,0,1,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(20122)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<2,0,1,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(201222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<2,0,1,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(2012222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<2,0,1,2,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(202)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<2,0,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(2022)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<2,0,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(20222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<2,0,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(202222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<2,0,2,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(2022222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<2,0,2,2,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(21)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<2,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(211)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<2,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(2111)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<2,1,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(21111)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<2,1,1,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(211111)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<2,1,1,1,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(2111111)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<2,1,1,1,1,1,1>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(2111112)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<2,1,1,1,1,1,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(211112)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<2,1,1,1,1,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(2111122)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<2,1,1,1,1,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(21112)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<2,1,1,1,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(211122)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<2,1,1,1,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(2111222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<2,1,1,1,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(2112)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<2,1,1,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(21122)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<2,1,1,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(211222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<2,1,1,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(2112222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<2,1,1,2,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(212)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<2,1,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(2122)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<2,1,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(21222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<2,1,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(212222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<2,1,2,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(2122222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<2,1,2,2,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(22)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(2222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<2,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(22222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<2,2,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(222222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<2,2,2,2,2,2>>},
+{std::string_view{"engine::DistinctTarget,engine::TableScan,2,(01),(2222222)"},&PipelineFunctions::runPipeline<engine::DistinctTarget, engine::TableScan, 2, std::index_sequence<0,1>, std::index_sequence<2,2,2,2,2,2,2>>},
 {std::string_view{"engine::HashtableBuild,engine::TableScan,0,(),(0)"},&PipelineFunctions::runPipeline<engine::HashtableBuild, engine::TableScan, 0, std::index_sequence<>, std::index_sequence<0>>},
 {std::string_view{"engine::HashtableBuild,engine::TableScan,0,(),(00)"},&PipelineFunctions::runPipeline<engine::HashtableBuild, engine::TableScan, 0, std::index_sequence<>, std::index_sequence<0,0>>},
 {std::string_view{"engine::HashtableBuild,engine::TableScan,0,(),(000)"},&PipelineFunctions::runPipeline<engine::HashtableBuild, engine::TableScan, 0, std::index_sequence<>, std::index_sequence<0,0,0>>},
@@ -1,75 +1,110 @@
 #include "pipeline/PipelineGen.hpp"
 namespace engine {
-template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<1,1,2,2,2>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
-template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<1,1,2,2,2,2>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
-template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<1,1,2,2,2,2,2>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
-template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<1,2>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
-template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<1,2,2>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
-template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<1,2,2,2>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
-template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<1,2,2,2,2>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
-template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<1,2,2,2,2,2>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
-template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<1,2,2,2,2,2,2>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
-template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
-template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
-template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,0>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
-template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,0,0>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
-template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,0,0,0>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
-template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,0,0,0,0>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
-template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,0,0,0,0,0>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
-template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,0,0,0,0,1>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
-template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,0,0,0,0,2>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
-template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,0,0,0,1>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
-template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,0,0,0,1,1>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
-template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,0,0,0,1,2>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
-template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,0,0,0,2>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
-template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,0,0,0,2,2>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
-template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,0,0,1>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
-template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,0,0,1,1>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
-template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,0,0,1,1,1>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
-template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,0,0,1,1,2>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
-template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,0,0,1,2>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
-template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,0,0,1,2,2>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
-template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,0,0,2>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
-template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,0,0,2,2>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
-template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,0,0,2,2,2>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
-template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,0,1>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
-template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,0,1,1>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
-template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,0,1,1,1>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
-template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,0,1,1,1,1>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
-template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,0,1,1,1,2>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
-template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,0,1,1,2>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
-template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,0,1,1,2,2>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
-template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,0,1,2>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
-template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,0,1,2,2>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
-template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,0,1,2,2,2>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
-template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,0,2>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
-template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,0,2,2>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
-template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,0,2,2,2>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
-template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,0,2,2,2,2>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
-template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,1>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
-template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,1,1>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
-template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,1,1,1>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
-template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,1,1,1,1>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
-template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,1,1,1,1,1>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
-template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,1,1,1,1,2>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
-template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,1,1,1,2>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
-template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,1,1,1,2,2>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
-template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,1,1,2>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
-template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,1,1,2,2>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
-template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,1,1,2,2,2>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
-template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,1,2>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
-template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,1,2,2>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
-template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,1,2,2,2>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
-template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,1,2,2,2,2>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
-template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,2>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
-template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,2,2>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
-template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,2,2,2>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
-template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,2,2,2,2>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
-template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,0,2,2,2,2,2>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
-template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,1>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
-template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,1,1>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
-template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,1,1,1>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
-template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,1,1,1,1>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
-template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,1,1,1,1,1>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
-template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<2,1,1,1,1,1,1>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 1, std::index_sequence<0>, std::index_sequence<1,0,0>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 1, std::index_sequence<0>, std::index_sequence<1,0,0,0>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 1, std::index_sequence<0>, std::index_sequence<1,0,0,0,0>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 1, std::index_sequence<0>, std::index_sequence<1,0,0,0,0,0>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 1, std::index_sequence<0>, std::index_sequence<1,0,0,0,0,0,0>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 1, std::index_sequence<0>, std::index_sequence<1,0,0,0,0,0,1>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 1, std::index_sequence<0>, std::index_sequence<1,0,0,0,0,1>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 1, std::index_sequence<0>, std::index_sequence<1,0,0,0,0,1,1>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 1, std::index_sequence<0>, std::index_sequence<1,0,0,0,1>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 1, std::index_sequence<0>, std::index_sequence<1,0,0,0,1,1>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 1, std::index_sequence<0>, std::index_sequence<1,0,0,0,1,1,1>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 1, std::index_sequence<0>, std::index_sequence<1,0,0,1>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 1, std::index_sequence<0>, std::index_sequence<1,0,0,1,1>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 1, std::index_sequence<0>, std::index_sequence<1,0,0,1,1,1>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 1, std::index_sequence<0>, std::index_sequence<1,0,0,1,1,1,1>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 1, std::index_sequence<0>, std::index_sequence<1,0,1>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 1, std::index_sequence<0>, std::index_sequence<1,0,1,1>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 1, std::index_sequence<0>, std::index_sequence<1,0,1,1,1>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 1, std::index_sequence<0>, std::index_sequence<1,0,1,1,1,1>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 1, std::index_sequence<0>, std::index_sequence<1,0,1,1,1,1,1>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 1, std::index_sequence<0>, std::index_sequence<1,1>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 1, std::index_sequence<0>, std::index_sequence<1,1,1>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 1, std::index_sequence<0>, std::index_sequence<1,1,1,1>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 1, std::index_sequence<0>, std::index_sequence<1,1,1,1,1>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 1, std::index_sequence<0>, std::index_sequence<1,1,1,1,1,1>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 1, std::index_sequence<0>, std::index_sequence<1,1,1,1,1,1,1>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,0>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,0,0>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,0,0,0>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,0,0,0,0>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,0,0,0,0,0>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,0,0,0,0,1>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,0,0,0,0,2>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,0,0,0,1>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,0,0,0,1,1>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,0,0,0,1,2>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,0,0,0,2>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,0,0,0,2,2>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,0,0,1>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,0,0,1,1>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,0,0,1,1,1>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,0,0,1,1,2>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,0,0,1,2>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,0,0,1,2,2>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,0,0,2>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,0,0,2,2>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,0,0,2,2,2>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,0,1>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,0,1,1>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,0,1,1,1>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,0,1,1,1,1>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,0,1,1,1,2>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,0,1,1,2>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,0,1,1,2,2>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,0,1,2>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,0,1,2,2>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,0,1,2,2,2>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,0,2>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,0,2,2>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,0,2,2,2>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,0,2,2,2,2>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,1>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,1,1>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,1,1,1>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,1,1,1,1>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,1,1,1,1,1>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,1,1,1,1,2>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,1,1,1,2>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,1,1,1,2,2>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,1,1,2>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,1,1,2,2>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,1,1,2,2,2>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,1,2>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,1,2,2>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,1,2,2,2>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,1,2,2,2,2>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,2>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,2,2>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,2,2,2>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,2,2,2,2>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,0,2,2,2,2,2>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,1>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,1,1>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,1,1,1>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,1,1,1,1>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,1,1,1,1,1>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,1,1,1,1,1,1>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,1,1,1,1,1,2>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,1,1,1,1,2>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,1,1,1,1,2,2>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,1,1,1,2>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,1,1,1,2,2>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,1,1,1,2,2,2>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,1,1,2>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,1,1,2,2>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,1,1,2,2,2>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,1,1,2,2,2,2>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,1,2>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,1,2,2>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,1,2,2,2>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,1,2,2,2,2>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,1,2,2,2,2,2>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,2>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
+template void PipelineFunctions::runPipeline<engine::TableTarget, engine::TableScan, 2, std::index_sequence<0,0>, std::index_sequence<0,2,2>>(TargetBase&, ScanBase&, engine::span<const DefaultProbeParameter>, engine::span<const unsigned>, engine::span<const unsigned>);
 }
@@ -0,0 +1,220 @@
+#include "query/CSVLoader.hpp"
+#include "infra/Mmap.hpp"
+#include "infra/PageMemory.hpp"
+#include "infra/QueryMemory.hpp"
+#include "infra/Scheduler.hpp"
+#include "infra/helper/BitOps.hpp"
+#include "op/TableTarget.hpp"
+#include "query/DataSource.hpp"
+#include "query/RuntimeValue.hpp"
+#include "storage/StringPtr.hpp"
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <csv_parser.h>
+#include <statement.h>
+//---------------------------------------------------------------------------
+namespace engine {
+//---------------------------------------------------------------------------
+namespace {
+//---------------------------------------------------------------------------
+/// The state of a worker, it lives across the chunks that the worker parses
+struct WorkerState {
+    /// A string that is referenced by the buffer of the local state
+    struct StringSlot {
+        /// The string
+        std::string value;
+        /// The pages of a long string
+        std::vector<DataSource::Page> pages;
+        /// The pointers to the pages, the string pointer references them
+        std::vector<DataSource::Page*> pagePointers;
+    };
+
+    /// The local state of the target
+    TableTarget::LocalState* state = nullptr;
+    /// The strings of the records in the buffer of the local state. The target only copies them when it flushes the buffer
+    std::vector<StringSlot> strings;
+    /// The values of the current record
+    std::vector<uint64_t> values;
+    /// The current record, only needed for the filter
+    std::vector<Data> record;
+};
+//---------------------------------------------------------------------------
+/// Parses a chunk and passes the records to the local state of the worker
+class ChunkParser final : public CSVParser {
+    /// The attributes
+    const std::vector<Attribute>& attributes;
+    /// The optional filter
+    Statement* filter;
+    /// The target
+    TableTarget& target;
+    /// The worker
+    WorkerState& worker;
+    /// Skip the first record?
+    bool header;
+
+    /// Parse a number
+    template <typename T>
+    bool parseNumber(const char* begin, size_t len, T& value) {
+        auto result = std::from_chars(begin, begin + len, value);
+        return result.ec == std::errc();
+    }
+    /// Store a string in the slot of the current record
+    uint64_t storeString(unsigned column, const char* begin, size_t len) {
+        auto& slot = worker.strings[(worker.state->curBuffer - worker.state->buffer) * attributes.size() + column];
+        if (len <= DataSource::PAGE_SIZE - 7) {
+            slot.value.assign(begin, len);
+            return StringPtr::fromString(slot.value).val();
+        }
+        // Long strings span pages that hold up to PAGE_SIZE - 4 bytes each, like the pages of the input
+        constexpr size_t pageCapacity = DataSource::PAGE_SIZE - 4;
+        size_t numPages = (len + pageCapacity - 1) / pageCapacity;
+        slot.pages.resize(numPages);
+        slot.pagePointers.resize(numPages);
+        for (size_t i = 0; i < numPages; i++) {
+            auto& page = slot.pages[i];
+            size_t size = std::min(pageCapacity, len - i * pageCapacity);
+            page.numRows = i ? 0xfffe : 0xffff;
+            page.numNotNull = size;
+            memcpy(page.data, begin + i * pageCapacity, size);
+            slot.pagePointers[i] = &page;
+        }
+        return StringPtr::fromLongString(slot.pagePointers.data(), numPages).val();
+    }
+
+    public:
+    /// Did a value not match its type?
+    bool invalid = false;
+
+    /// Constructor
+    ChunkParser(const std::vector<Attribute>& attributes, Statement* filter, TableTarget& target, WorkerState& worker, bool header, char escape, char sep)
+        : CSVParser(escape, sep, false), attributes(attributes), filter(filter), target(target), worker(worker), header(header) {}
+
+    /// Convert a field to the value representation of the engine
+    void on_field(size_t column, size_t row, const char* begin, size_t len) override {
+        if ((header && row == 0) || invalid)
+            return;
+        if (column >= attributes.size()) {
+            invalid = true;
+            return;
+        }
+        auto& value = worker.values[column];
+        if (len == 0) {
+            value = RuntimeValue::nullValue;
+            if (filter)
+                worker.record[column] = std::monostate{};
+        } else {
+            switch (attributes[column].type) {
+                case DataType::INT32: {
+                    int32_t v{};
+                    invalid |= !parseNumber(begin, len, v);
+                    value = static_cast<uint32_t>(v);
+                    if (filter)
+                        worker.record[column] = v;
+                    break;
+                }
+                case DataType::INT64: {
+                    int64_t v{};
+                    invalid |= !parseNumber(begin, len, v);
+                    value = static_cast<uint64_t>(v);
+                    if (filter)
+                        worker.record[column] = v;
+                    break;
+                }
+                case DataType::FP64: {
+                    double v{};
+                    invalid |= !parseNumber(begin, len, v);
+                    value = engine::bit_cast<uint64_t>(v);
+                    if (filter)
+                        worker.record[column] = v;
+                    break;
+                }
+                case DataType::VARCHAR: {
+                    value = storeString(column, begin, len);
+                    if (filter)
+                        worker.record[column] = std::string(begin, len);
+                    break;
+                }
+            }
+        }
+        if (column + 1 == attributes.size() && !invalid && (!filter || filter->eval(worker.record)))
+            target.consumeTuple(*worker.state, 1, worker.values.data());
+    }
+};
+//---------------------------------------------------------------------------
+}
+//---------------------------------------------------------------------------
+std::vector<size_t> CSVLoader::splitChunks(std::string_view data, char escape, size_t chunkSize) {
+    // Same quoting rules as the parser: quotes toggle the quoted state, the escape character only escapes within quotes
+    std::vector<size_t> starts{0};
+    bool quoted = false;
+    for (size_t i = 0, next = chunkSize; i < data.size(); i++) {
+        char c = data[i];
+        if (c == '"') {
+            quoted = !quoted;
+        } else if (quoted) {
+            if (c == escape)
+                i++;
+        } else if (c == '\n' && i + 1 >= next && i + 1 < data.size()) {
+            starts.push_back(i + 1);
+            next = i + 1 + chunkSize;
+        }
+    }
+    return starts;
+}
+//---------------------------------------------------------------------------
+ColumnarTable CSVLoader::load(const std::vector<Attribute>& attributes, const std::filesystem::path& path, Statement* filter, bool header, char escape, char sep, size_t chunkSize) {
+    if (!std::filesystem::exists(path))
+        throw std::runtime_error("Cannot open " + path.string());
+    // Empty files cannot be mapped
+    auto file = Mmap::mapFile(path.string());
+    std::string_view data(file.data(), file ? file.size() : 0);
+    auto chunks = data.empty() ? std::vector<size_t>{} : splitChunks(data, escape, chunkSize);
+    chunks.push_back(data.size());
+
+    Scheduler::start_query();
+    pagememory::start_query();
+    ColumnarTable result;
+    std::atomic<bool> failed = false;
+    {
+        SmallVec<DataType> types;
+        for (auto& attribute : attributes)
+            types.push_back(attribute.type);
+        TableTarget target(std::move(types));
+        std::vector<WorkerState> workers(Scheduler::concurrency());
+        Scheduler::parallelMorsel(0, chunks.size() - 1, 1, [&](size_t workerId, size_t chunk) {
+            auto& worker = workers[workerId];
+            if (chunk == ~0ull - 1) {
+                worker.state = new (querymemory::allocate(sizeof(TableTarget::LocalState))) TableTarget::LocalState(target);
+                worker.strings.resize(TableTarget::LocalState::bufferCount * attributes.size());
+                worker.values.resize(attributes.size());
+                if (filter)
+                    worker.record.resize(attributes.size());
+            } else if (chunk == ~0ull) {
+                target.finalize(*worker.state);
+            } else if (!failed.load(std::memory_order_relaxed)) {
+                ChunkParser parser(attributes, filter, target, worker, header && chunk == 0, escape, sep);
+                if (parser.execute(data.data() + chunks[chunk], chunks[chunk + 1] - chunks[chunk]) != CSVParser::Ok || parser.finish() != CSVParser::Ok || parser.invalid)
+                    failed.store(true);
+            } }, true);
+        target.finishConsume();
+        if (target.localStates.empty()) {
+            // No chunk was parsed, i.e., the file is empty
+            for (auto& attribute : attributes)
+                result.columns.emplace_back(attribute.type);
+        } else {
+            result = target.extract();
+        }
+    }
+    querymemory::end_query();
+    Scheduler::end_query();
+    if (failed.load())
+        throw std::runtime_error("CSV parse error in " + path.string());
+    return result;
+}
+//---------------------------------------------------------------------------
+}
+//---------------------------------------------------------------------------
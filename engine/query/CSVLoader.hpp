@@ -0,0 +1,30 @@
+#pragma once
+//---------------------------------------------------------------------------
+#include <cstddef>
+#include <filesystem>
+#include <string_view>
+#include <vector>
+#include <attribute.h>
+#include <plan.h>
+//---------------------------------------------------------------------------
+struct Statement;
+//---------------------------------------------------------------------------
+namespace engine {
+//---------------------------------------------------------------------------
+/// Loads CSV files in parallel. The file is split into chunks at record boundaries, the workers parse the chunks and write the values
+/// directly into pages with the writers of a TableTarget. Neither the rows nor whole columns are materialized in between
+class CSVLoader {
+    public:
+    /// The minimum size of a chunk
+    static constexpr size_t chunkSize = 4ull << 20;
+
+    /// Find the starts of the chunks, i.e., of the first records that start at least chunkSize bytes after the previous chunk.
+    /// Newlines in quoted fields do not end a record
+    static std::vector<size_t> splitChunks(std::string_view data, char escape, size_t chunkSize = CSVLoader::chunkSize);
+    /// Load a table, only the records that satisfy the optional filter are kept. The records of a chunk stay in order, the chunks do not.
+    /// Runs as its own query, so it must not be called while a query is running
+    static ColumnarTable load(const std::vector<Attribute>& attributes, const std::filesystem::path& path, Statement* filter, bool header = false, char escape = '\\', char sep = ',', size_t chunkSize = CSVLoader::chunkSize);
+};
+//---------------------------------------------------------------------------
+}
+//---------------------------------------------------------------------------
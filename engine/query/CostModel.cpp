@@ -0,0 +1,163 @@
+#include "query/CostModel.hpp"
+#include "infra/PageMemory.hpp"
+#include "infra/QueryMemory.hpp"
+#include "infra/Random.hpp"
+#include "infra/Scheduler.hpp"
+#include "infra/helper/BitOps.hpp"
+#include "op/Hashtable.hpp"
+#include "op/TableScan.hpp"
+#include "op/TableTarget.hpp"
+#include "pipeline/PipelineFunction.hpp"
+#include "query/PlanImport.hpp"
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+#include <plan.h>
+//---------------------------------------------------------------------------
+namespace engine {
+//---------------------------------------------------------------------------
+CostModel CostModel::current;
+//---------------------------------------------------------------------------
+namespace {
+//---------------------------------------------------------------------------
+/// The number of runs per benchmark, the fastest one counts
+constexpr unsigned numRuns = 3;
+/// The number of tuples that are scanned and probed per benchmark
+constexpr size_t numProbeTuples = 1ull << 20;
+/// The marker of the file
+constexpr uint64_t markerValue = 0x6c65646f4d74736full;
+//---------------------------------------------------------------------------
+/// The stored model
+struct StoredModel {
+    uint64_t marker;
+    uint64_t numSizeClasses;
+    double tupleNanos;
+    double build;
+    double probe[CostModel::numSizeClasses];
+};
+//---------------------------------------------------------------------------
+/// A single INT32 column that can be scanned
+struct BenchmarkTable {
+    ColumnarTable columnar;
+    DataSource::Table table;
+
+    template <typename Gen>
+    BenchmarkTable(size_t numRows, Gen&& gen) {
+        auto& column = columnar.columns.emplace_back(DataType::INT32);
+        ColumnInserter<int32_t> inserter(column);
+        for (size_t i = 0; i < numRows; i++)
+            inserter.insert(static_cast<int32_t>(gen(i)));
+        inserter.finalize();
+        columnar.num_rows = numRows;
+        table = PlanImport::importTable(columnar);
+    }
+};
+//---------------------------------------------------------------------------
+/// Run a benchmark repeatedly, each run within its own query. The benchmark passes every pipeline it measures to the timer.
+/// Returns the fastest time in nanoseconds per pipeline
+template <size_t N, typename Fun>
+std::array<double, N> measure(Fun&& fun) {
+    std::array<double, N> best;
+    best.fill(std::numeric_limits<double>::infinity());
+    for (unsigned run = 0; run < numRuns; run++) {
+        Scheduler::start_query();
+        pagememory::start_query();
+        fun([&](size_t step, auto&& pipeline) {
+            auto start = std::chrono::steady_clock::now();
+            pipeline();
+            auto end = std::chrono::steady_clock::now();
+            best[step] = std::min(best[step], std::chrono::duration<double, std::nano>(end - start).count());
+        });
+        querymemory::end_query();
+        Scheduler::end_query();
+    }
+    return best;
+}
+//---------------------------------------------------------------------------
+}
+//---------------------------------------------------------------------------
+double CostModel::probeCost(double buildCard) const {
+    auto shift = static_cast<unsigned>(engine::bit_width(static_cast<uint64_t>(std::clamp(buildCard, 1.0, 0x1p62))));
+    size_t sizeClass = (shift > minSizeShift) ? std::min<size_t>((shift - minSizeShift) / 2, numSizeClasses - 1) : 0;
+    return probe[sizeClass];
+}
+//---------------------------------------------------------------------------
+CostModel CostModel::calibrate() {
+    static constexpr unsigned zero = 0;
+    auto scanPipeline = PipelineFunctions::lookupPipeline("engine::TableTarget,engine::TableScan,0,(),(0)");
+    auto buildPipeline = PipelineFunctions::lookupPipeline("engine::HashtableBuild,engine::TableScan,0,(),(0)");
+    auto probePipeline = PipelineFunctions::lookupPipeline("engine::TableTarget,engine::TableScan,1,(0),(0)");
+    Random rng;
+
+    // Producing a tuple, i.e., scanning and materializing it, is the unit of all costs
+    BenchmarkTable scanTable(numProbeTuples, [&](size_t) { return rng.nextRange(numProbeTuples); });
+    auto scanTime = measure<1>([&](auto&& timer) {
+        auto info = TableScan::makeTableInfo(scanTable.table);
+        TableScan scan(info);
+        TableTarget target({DataType::INT32});
+        timer(0, [&] { scanPipeline(target, scan, {}, {}, {&zero, 1}); });
+    });
+
+    CostModel result;
+    result.tupleNanos = scanTime[0] / numProbeTuples;
+    double buildTime = 0;
+    size_t buildTuples = 0;
+    for (size_t sizeClass = 0; sizeClass < numSizeClasses; sizeClass++) {
+        // Build a hash table with unique keys and probe it with keys that all find exactly one match
+        size_t size = 1ull << (minSizeShift + 2 * sizeClass);
+        BenchmarkTable buildTable(size, [](size_t i) { return i; });
+        BenchmarkTable probeTable(numProbeTuples, [&](size_t) { return rng.nextRange(size); });
+        auto times = measure<2>([&](auto&& timer) {
+            auto buildInfo = TableScan::makeTableInfo(buildTable.table);
+            TableScan buildScan(buildInfo);
+            Hashtable ht;
+            HashtableBuild build(ht, size);
+            timer(0, [&] { buildPipeline(build, buildScan, {}, {}, {&zero, 1}); });
+
+            auto probeInfo = TableScan::makeTableInfo(probeTable.table);
+            TableScan probeScan(probeInfo);
+            TableTarget target({DataType::INT32});
+            const Hashtable* probes[] = {&ht};
+            timer(1, [&] { probePipeline(target, probeScan, {probes, 1}, {&zero, 1}, {&zero, 1}); });
+        });
+        buildTime += times[0];
+        buildTuples += size;
+        // The probe pipeline produces every tuple like the scan, only the additional work counts
+        result.probe[sizeClass] = std::max(times[1] / scanTime[0] - 1.0, 0.0);
+    }
+    result.build = (buildTime / buildTuples) / result.tupleNanos;
+    return result;
+}
+//---------------------------------------------------------------------------
+void CostModel::store(const std::string& filename) const {
+    StoredModel stored{markerValue, numSizeClasses, tupleNanos, build, {}};
+    std::copy(probe.begin(), probe.end(), stored.probe);
+
+    std::string targetFile = filename + ".tmp";
+    std::ofstream file(targetFile, std::ios::binary);
+    file.write(reinterpret_cast<const char*>(&stored), sizeof(stored));
+    if (!file)
+        throw std::runtime_error("Failed to write file");
+    file.close();
+    if (rename(targetFile.c_str(), filename.c_str()) != 0)
+        throw std::runtime_error("Failed to rename temp file to correct destination");
+}
+//---------------------------------------------------------------------------
+bool CostModel::load(const std::string& filename) {
+    if (!std::filesystem::exists(filename))
+        return false;
+    StoredModel stored;
+    std::ifstream file(filename, std::ios::binary);
+    file.read(reinterpret_cast<char*>(&stored), sizeof(stored));
+    if (!file || stored.marker != markerValue || stored.numSizeClasses != numSizeClasses)
+        throw std::runtime_error("File is corrupted, invalid cost model");
+    tupleNanos = stored.tupleNanos;
+    build = stored.build;
+    std::copy(stored.probe, stored.probe + numSizeClasses, probe.begin());
+    return true;
+}
+//---------------------------------------------------------------------------
+}
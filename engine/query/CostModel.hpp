@@ -0,0 +1,47 @@
+#pragma once
+//---------------------------------------------------------------------------
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+//---------------------------------------------------------------------------
+namespace engine {
+//---------------------------------------------------------------------------
+/// The per tuple costs of the operators that the optimizer uses. All costs are relative to producing one tuple in a pipeline,
+/// i.e., scanning a tuple and passing it to the target. The defaults are used until the model is calibrated on the machine
+struct CostModel {
+    /// The number of hash table size classes for probes
+    static constexpr size_t numSizeClasses = 7;
+    /// Size class i covers hash tables with about 2^(minSizeShift + 2 * i) tuples
+    static constexpr unsigned minSizeShift = 10;
+    /// The file the calibrated model is stored in
+    static constexpr const char* defaultFile = ".costmodel";
+
+    /// The time of producing one tuple in nanoseconds, i.e., the unit of the costs. Only informational
+    double tupleNanos = 0.0;
+    /// The cost of materializing a tuple into a hash table
+    double build = 10.0;
+    /// The additional cost of probing a hash table with a tuple, by size class of the hash table
+    std::array<double, numSizeClasses> probe = {};
+
+    /// The additional cost of probing a hash table with the given number of tuples
+    double probeCost(double buildCard) const;
+
+    /// Measure the costs with micro-benchmarks of the pipelines. Requires a set up scheduler and must not run concurrently to a query
+    static CostModel calibrate();
+    /// Store the model
+    void store(const std::string& filename) const;
+    /// Load a model, returns false if the file does not exist
+    bool load(const std::string& filename);
+
+    /// Get the model that the optimizer uses
+    static const CostModel& get() noexcept { return current; }
+    /// Set the model that the optimizer uses, must not run concurrently to a query
+    static void set(const CostModel& model) noexcept { current = model; }
+
+    private:
+    /// The model that the optimizer uses
+    static CostModel current;
+};
+//---------------------------------------------------------------------------
+}
@@ -2,9 +2,16 @@
 #include "infra/helper/Misc.hpp"
 #include "infra/Scheduler.hpp"
 #include "infra/Util.hpp"
+#include "query/Restriction.hpp"
+#include "storage/BitPacking.hpp"
+#include "storage/ColumnStatistics.hpp"
+#include "storage/StringPtr.hpp"
+#include <algorithm>
 #include <cstring>
 #include <exception>
 #include <fstream>
+#include <optional>
+#include <unordered_map>
 //---------------------------------------------------------------------------
 namespace engine {
 //---------------------------------------------------------------------------
@@ -35,6 +42,58 @@ struct DataSource::ColumnHeader {
     uint64_t pageEnd;
 };
 //---------------------------------------------------------------------------
+/// Follows the table headers, older files do not contain it
+struct DataSource::ZoneMapHeader {
+    static constexpr uint64_t markerValue = []() {
+        uint64_t marker = 0;
+        std::string_view txt("zonemap1");
+        for (size_t i = 0; i < txt.size(); ++i)
+            marker |= uint64_t(txt[i]) << (i * 8);
+        return marker;
+    }();
+    uint64_t marker;
+    uint64_t numColumns;
+};
+//---------------------------------------------------------------------------
+/// Follows the zone map header, older files do not contain it
+struct DataSource::DictionaryHeader {
+    static constexpr uint64_t markerValue = []() {
+        uint64_t marker = 0;
+        std::string_view txt("dictnry1");
+        for (size_t i = 0; i < txt.size(); ++i)
+            marker |= uint64_t(txt[i]) << (i * 8);
+        return marker;
+    }();
+    uint64_t marker;
+    uint64_t numColumns;
+};
+//---------------------------------------------------------------------------
+/// Follows the dictionary header, older files do not contain it
+struct DataSource::BitPackingHeader {
+    static constexpr uint64_t markerValue = []() {
+        uint64_t marker = 0;
+        std::string_view txt("bitpack1");
+        for (size_t i = 0; i < txt.size(); ++i)
+            marker |= uint64_t(txt[i]) << (i * 8);
+        return marker;
+    }();
+    uint64_t marker;
+    uint64_t numColumns;
+};
+//---------------------------------------------------------------------------
+/// Follows the bit packing header, older files do not contain it. The statistics of the columns follow it
+struct DataSource::StatisticsHeader {
+    static constexpr uint64_t markerValue = []() {
+        uint64_t marker = 0;
+        std::string_view txt("colstat1");
+        for (size_t i = 0; i < txt.size(); ++i)
+            marker |= uint64_t(txt[i]) << (i * 8);
+        return marker;
+    }();
+    uint64_t marker;
+    uint64_t numColumns;
+};
+//---------------------------------------------------------------------------
 // 2MB should be enough for anybody
 static constexpr size_t HEADER_SIZE = 1ull << 21;
 static_assert(HEADER_SIZE % PAGE_SIZE == 0);
@@ -47,6 +106,272 @@ std::string DataSource::Table::fixName(std::string name) {
     return std::move(name);
 }
 //---------------------------------------------------------------------------
+uint64_t DataSource::ZoneMap::stringKey(const char* str, size_t len) {
+    uint64_t key = 0;
+    memcpy(&key, str, std::min<size_t>(len, sizeof(key)));
+    return __builtin_bswap64(key);
+}
+//---------------------------------------------------------------------------
+DataSource::ZoneMap DataSource::ZoneMap::compute(DataType type, const Page& page, bool bitPacked) {
+    ZoneMap result{~0ull, 0};
+    // Long strings and doubles do not have a usable order
+    if (page.isAnyLongString() || type == DataType::FP64)
+        return {0, ~0ull};
+    auto update = [&](uint64_t value) {
+        result.min = std::min(result.min, value);
+        result.max = std::max(result.max, value);
+    };
+    if (bitPacked) {
+        uint32_t values[BitPacking::blockSize];
+        auto* blocks = BitPacking::getBlocks(page);
+        for (size_t begin = 0; begin < page.numNotNull; begin += BitPacking::blockSize) {
+            auto& block = blocks[begin / BitPacking::blockSize];
+            auto count = std::min<size_t>(page.numNotNull - begin, BitPacking::blockSize);
+            BitPacking::unpack(values, reinterpret_cast<const uint8_t*>(page.data) + block.offset, block.width, block.base, count);
+            for (size_t i = 0; i < count; i++)
+                update(values[i]);
+        }
+        return result;
+    }
+    switch (type) {
+        case DataType::INT32:
+            for (auto *cur = page.getData<uint32_t>(), *end = cur + page.numNotNull; cur != end; ++cur)
+                update(*cur);
+            break;
+        case DataType::INT64:
+            for (auto *cur = page.getData<uint64_t>(), *end = cur + page.numNotNull; cur != end; ++cur)
+                update(*cur);
+            break;
+        case DataType::VARCHAR: {
+            auto* offsets = page.getData<uint16_t>();
+            auto* strings = page.getStrings();
+            for (size_t i = 0, begin = 0; i < page.numNotNull; begin = offsets[i++])
+                update(stringKey(strings + begin, offsets[i] - begin));
+            break;
+        }
+        case DataType::FP64: break;
+    }
+    return result;
+}
+//---------------------------------------------------------------------------
+/// The dictionary of a dictionary encoded VARCHAR column
+struct DictionaryEncoding {
+    /// The sorted distinct strings
+    std::vector<std::string_view> entries;
+    /// The code of each string
+    std::unordered_map<std::string_view, uint32_t> codes;
+};
+//---------------------------------------------------------------------------
+/// Iterate over the strings of a VARCHAR column without long strings, nulls are passed as nullopt
+template <typename CallbackT>
+static void iterateStrings(const DataSource::Column& column, CallbackT&& callback) {
+    for (const auto* page : column.pages) {
+        auto* offsets = page->getData<uint16_t>();
+        auto* strings = page->getStrings();
+        for (size_t i = 0, j = 0; i < page->numRows; i++) {
+            if (!page->hasNoNulls() && page->isNull(i)) {
+                callback(std::optional<std::string_view>());
+            } else {
+                size_t begin = j ? offsets[j - 1] : 0;
+                callback(std::optional<std::string_view>(std::string_view(strings + begin, offsets[j] - begin)));
+                j++;
+            }
+        }
+    }
+}
+//---------------------------------------------------------------------------
+/// Iterate over the 32 bit values that are stored for a column, i.e., its INT32 values or its dictionary codes. Nulls are passed as nullopt
+template <typename CallbackT>
+static void iterateValues32(const DataSource::Column& column, const DictionaryEncoding* dictionary, CallbackT&& callback) {
+    if (dictionary && !column.isDictionaryEncoded()) {
+        iterateStrings(column, [&](std::optional<std::string_view> str) {
+            callback(str ? std::optional<uint32_t>(dictionary->codes.at(*str)) : std::nullopt);
+        });
+        return;
+    }
+    auto decoder = column.bitPacked ? std::make_unique<BitPacking::Decoder>() : nullptr;
+    for (const auto* page : column.pages) {
+        auto* values = decoder ? decoder->get(page, 0, page->numNotNull) : page->getData<uint32_t>();
+        for (size_t i = 0, j = 0; i < page->numRows; i++) {
+            if (!page->hasNoNulls() && page->isNull(i))
+                callback(std::optional<uint32_t>());
+            else
+                callback(std::optional<uint32_t>(values[j++]));
+        }
+    }
+}
+//---------------------------------------------------------------------------
+/// Write 32 bit values into plain INT32 pages
+template <typename IterateT, typename ConsumerT>
+static void writePlainPages(IterateT&& iterate, ConsumerT&& consumer) {
+    auto page = std::make_unique<DataSource::Page>();
+    std::vector<uint32_t> values;
+    std::vector<uint8_t> notNulls;
+    size_t numRows = 0;
+    auto flush = [&]() {
+        *page = {};
+        page->numRows = numRows;
+        page->numNotNull = values.size();
+        memcpy(page->getData<uint32_t>(), values.data(), values.size() * sizeof(uint32_t));
+        memcpy(page->getNulls(), notNulls.data(), (numRows + 7) / 8);
+        consumer(*page, DataSource::ZoneMap::compute(DataType::INT32, *page));
+        values.clear();
+        notNulls.clear();
+        numRows = 0;
+    };
+    iterate([&](std::optional<uint32_t> value) {
+        if (((values.size() + 1) * sizeof(uint32_t) + (numRows + 8) / 8 > sizeof(page->data)) || numRows == 0xfff0)
+            flush();
+        if (numRows % 8 == 0)
+            notNulls.push_back(0);
+        if (value) {
+            notNulls.back() |= 1 << (numRows % 8);
+            values.push_back(*value);
+        }
+        numRows++;
+    });
+    if (numRows)
+        flush();
+}
+//---------------------------------------------------------------------------
+/// Write 32 bit values into bit packed pages
+template <typename IterateT, typename ConsumerT>
+static void writePackedPages(IterateT&& iterate, ConsumerT&& consumer) {
+    auto page = std::make_unique<DataSource::Page>();
+    BitPacking::PageWriter writer;
+    auto flush = [&]() {
+        writer.write(*page);
+        consumer(*page, DataSource::ZoneMap::compute(DataType::INT32, *page, true));
+    };
+    iterate([&](std::optional<uint32_t> value) {
+        if (!writer.add(value)) {
+            flush();
+            [[maybe_unused]] bool added = writer.add(value);
+            assert(added);
+        }
+    });
+    if (!writer.empty())
+        flush();
+}
+//---------------------------------------------------------------------------
+/// Decide whether to dictionary encode the column
+static std::optional<DictionaryEncoding> encodeDictionary(const DataSource::Column& column) {
+    if (column.type != DataType::VARCHAR)
+        return {};
+    DictionaryEncoding result;
+    if (column.isDictionaryEncoded()) {
+        // Keep the existing encoding
+        for (auto& value : column.dictionary)
+            result.entries.push_back(reinterpret_cast<const StringPtr&>(value).strView());
+        return result;
+    }
+    for (const auto* page : column.pages)
+        if (page->isAnyLongString())
+            return {};
+
+    size_t numValues = 0, numChars = 0;
+    bool tooLarge = false;
+    iterateStrings(column, [&](std::optional<std::string_view> str) {
+        if (!str || tooLarge)
+            return;
+        numValues++;
+        numChars += str->size();
+        if (result.codes.emplace(*str, 0).second && result.codes.size() > DataSource::maxDictionarySize)
+            tooLarge = true;
+    });
+    if (tooLarge || result.codes.empty())
+        return {};
+    // Only encode if the codes and the dictionary are smaller than the strings
+    size_t dictionaryChars = 0;
+    for (auto& [str, code] : result.codes)
+        dictionaryChars += str.size() + sizeof(uint32_t);
+    if (numValues * sizeof(uint32_t) + dictionaryChars >= numValues * sizeof(uint16_t) + numChars)
+        return {};
+
+    // Sorted codes keep the order of strings, so ranges of strings become ranges of codes
+    for (auto& [str, code] : result.codes)
+        result.entries.push_back(str);
+    std::sort(result.entries.begin(), result.entries.end());
+    for (uint32_t code = 0; code < result.entries.size(); code++)
+        result.codes[result.entries[code]] = code;
+    return result;
+}
+//---------------------------------------------------------------------------
+/// How a column is stored in the file
+struct ColumnLayout {
+    /// The dictionary if the column is dictionary encoded
+    std::optional<DictionaryEncoding> dictionary;
+    /// Are the 32 bit values bit packed?
+    bool bitPacked = false;
+    /// Must the pages be rewritten instead of copied?
+    bool rewrite = false;
+    /// The number of pages
+    size_t numPages = 0;
+
+    /// Iterate over the stored 32 bit values
+    template <typename CallbackT>
+    void iterate(const DataSource::Column& column, CallbackT&& callback) const {
+        iterateValues32(column, dictionary ? &*dictionary : nullptr, callback);
+    }
+};
+//---------------------------------------------------------------------------
+/// Decide how to store the column
+static ColumnLayout chooseLayout(const DataSource::Column& column) {
+    ColumnLayout result{encodeDictionary(column)};
+    result.numPages = column.pages.size();
+    if (column.type != DataType::INT32 && !result.dictionary)
+        return result;
+    auto iterate = [&](auto&& callback) { result.iterate(column, callback); };
+    result.rewrite = column.bitPacked || (result.dictionary && !column.isDictionaryEncoded());
+    if (result.rewrite) {
+        result.numPages = 0;
+        writePlainPages(iterate, [&](const DataSource::Page&, DataSource::ZoneMap) { result.numPages++; });
+    }
+    // Bit packing only pays off if it saves a considerable part of the pages
+    size_t packedPages = 0;
+    writePackedPages(iterate, [&](const DataSource::Page&, DataSource::ZoneMap) { packedPages++; });
+    if (packedPages * 4 <= result.numPages * 3) {
+        result.bitPacked = true;
+        result.rewrite = true;
+        result.numPages = packedPages;
+    }
+    return result;
+}
+//---------------------------------------------------------------------------
+/// Compute the statistics of the values that are stored for a column. VARCHAR columns with long strings are unknown
+static ColumnStatistics computeStatistics(const DataSource::Column& column, const ColumnLayout& layout) {
+    ColumnStatistics::Builder builder;
+    if (column.type == DataType::INT32 || layout.dictionary) {
+        layout.iterate(column, [&](std::optional<uint32_t> value) {
+            if (value)
+                builder.add(*value);
+            else
+                builder.addNull();
+        });
+    } else if (column.type == DataType::INT64 || column.type == DataType::FP64) {
+        for (const auto* page : column.pages) {
+            auto* values = page->getData<uint64_t>();
+            for (size_t i = 0, j = 0; i < page->numRows; i++) {
+                if (!page->hasNoNulls() && page->isNull(i))
+                    builder.addNull();
+                else
+                    builder.add(column.type == DataType::FP64 ? Restriction::doubleKey(values[j++]) : values[j++]);
+            }
+        }
+    } else {
+        for (const auto* page : column.pages)
+            if (page->isAnyLongString())
+                return {};
+        iterateStrings(column, [&](std::optional<std::string_view> str) {
+            if (str)
+                builder.add(DataSource::ZoneMap::stringKey(str->data(), str->size()), std::hash<std::string_view>()(*str));
+            else
+                builder.addNull();
+        });
+    }
+    return builder.finish();
+}
+//---------------------------------------------------------------------------
 void DataSource::serialize(const std::string& filename) && {
     std::string targetFile = filename + ".tmp";
     auto header = std::make_unique<uint64_t[]>(HEADER_SIZE / sizeof(uint64_t));
@@ -60,8 +385,18 @@ void DataSource::serialize(const std::string& filename) && {
         cur += sizeof(data) / sizeof(uint64_t);
     };
 
+    // Low cardinality string columns are stored as codes, narrow 32 bit values are bit packed
+    std::vector<ColumnLayout> layouts;
+    for (const auto& table : relations)
+        for (const auto& column : table.columns)
+            layouts.push_back(chooseLayout(column));
+    std::vector<size_t> numPages;
+    for (auto& layout : layouts)
+        numPages.push_back(layout.numPages);
+
     uint64_t curPage = HEADER_SIZE;
     write(Header{Header::markerValue, relations.size()});
+    size_t columnIndex = 0;
     for (const auto& table : relations) {
         TableHeader header{table.numRows, table.columns.size(), table.name.size()};
         memset(header.name, 0, sizeof(header.name));
@@ -69,20 +404,87 @@ void DataSource::serialize(const std::string& filename) && {
         memcpy(header.name, table.name.data(), table.name.size());
         write(header);
         for (const auto& column : table.columns) {
-            write(ColumnHeader{static_cast<uint64_t>(column.type), curPage, curPage + column.pages.size() * PAGE_SIZE});
-            curPage += column.pages.size() * PAGE_SIZE;
+            write(ColumnHeader{static_cast<uint64_t>(column.type), curPage, curPage + numPages[columnIndex] * PAGE_SIZE});
+            curPage += numPages[columnIndex++] * PAGE_SIZE;
         }
     }
+    // The zone maps of all columns are stored after the pages
+    write(ZoneMapHeader{ZoneMapHeader::markerValue, numPages.size()});
+    for (auto count : numPages) {
+        write(curPage);
+        curPage += count * sizeof(ZoneMap);
+    }
+    // The dictionaries follow the zone maps, each consists of the number of entries, the end offsets of the strings and the strings
+    write(DictionaryHeader{DictionaryHeader::markerValue, numPages.size()});
+    for (auto& layout : layouts) {
+        auto& dictionary = layout.dictionary;
+        if (!dictionary) {
+            write(uint64_t(0));
+            continue;
+        }
+        write(curPage);
+        size_t size = sizeof(uint64_t) + dictionary->entries.size() * sizeof(uint32_t);
+        for (auto str : dictionary->entries)
+            size += str.size();
+        curPage += (size + sizeof(uint64_t) - 1) & ~(sizeof(uint64_t) - 1);
+    }
+    write(BitPackingHeader{BitPackingHeader::markerValue, numPages.size()});
+    for (auto& layout : layouts)
+        write(uint64_t(layout.bitPacked));
+    // The statistics live in the header, they are left out if they do not fit
+    size_t statisticsSize = sizeof(StatisticsHeader) + numPages.size() * sizeof(ColumnStatistics);
+    if (cur + statisticsSize / sizeof(uint64_t) <= header.get() + HEADER_SIZE / sizeof(uint64_t)) {
+        write(StatisticsHeader{StatisticsHeader::markerValue, numPages.size()});
+        columnIndex = 0;
+        for (const auto& table : relations)
+            for (const auto& column : table.columns)
+                write(computeStatistics(column, layouts[columnIndex++]));
+    }
 
     std::ofstream file(targetFile, std::ios::binary);
     file.write(reinterpret_cast<const char*>(header.get()), HEADER_SIZE);
+    std::vector<std::vector<ZoneMap>> zoneMaps;
+    columnIndex = 0;
     for (const auto& table : relations) {
         for (const auto& column : table.columns) {
-            for (const auto* page : column.pages) {
-                file.write(reinterpret_cast<const char*>(page), PAGE_SIZE);
+            auto& layout = layouts[columnIndex++];
+            auto& columnZoneMaps = zoneMaps.emplace_back();
+            columnZoneMaps.reserve(layout.numPages);
+            auto writePage = [&](const Page& page, ZoneMap zoneMap) {
+                file.write(reinterpret_cast<const char*>(&page), PAGE_SIZE);
+                columnZoneMaps.push_back(zoneMap);
+            };
+            auto iterate = [&](auto&& callback) { layout.iterate(column, callback); };
+            if (layout.bitPacked) {
+                writePackedPages(iterate, writePage);
+            } else if (layout.rewrite) {
+                writePlainPages(iterate, writePage);
+            } else {
+                for (const auto* page : column.pages)
+                    writePage(*page, ZoneMap::compute(layout.dictionary ? DataType::INT32 : column.type, *page));
             }
+            assert(columnZoneMaps.size() == numPages[columnIndex - 1]);
         }
     }
+    for (auto& columnZoneMaps : zoneMaps)
+        file.write(reinterpret_cast<const char*>(columnZoneMaps.data()), columnZoneMaps.size() * sizeof(ZoneMap));
+    for (auto& layout : layouts) {
+        auto& dictionary = layout.dictionary;
+        if (!dictionary)
+            continue;
+        uint64_t count = dictionary->entries.size();
+        file.write(reinterpret_cast<const char*>(&count), sizeof(count));
+        uint32_t offset = 0;
+        for (auto str : dictionary->entries) {
+            offset += str.size();
+            file.write(reinterpret_cast<const char*>(&offset), sizeof(offset));
+        }
+        for (auto str : dictionary->entries)
+            file.write(str.data(), str.size());
+        size_t size = sizeof(uint64_t) + count * sizeof(uint32_t) + offset;
+        static constexpr char padding[sizeof(uint64_t)] = {};
+        file.write(padding, ((size + sizeof(uint64_t) - 1) & ~(sizeof(uint64_t) - 1)) - size);
+    }
 
     if (!file)
         throw std::runtime_error("Failed to write file");
@@ -150,12 +552,106 @@ DataSource DataSource::deserialize(const std::string& filename) {
                 curPage += PAGE_SIZE;
             }
             column.pages = column.pagesStorage;
+            column.mapped = true;
             table.columns.push_back(std::move(column));
         }
         result.relations.push_back(std::move(table));
     }
 
+    // Map the zone maps if the file contains them
+    auto zoneMapHeader = read(engine::type_identity<ZoneMapHeader>());
+    if (zoneMapHeader.marker == ZoneMapHeader::markerValue) {
+        uint64_t numColumns = 0;
+        for (auto& table : result.relations)
+            numColumns += table.columns.size();
+        if (zoneMapHeader.numColumns != numColumns) {
+            throw std::runtime_error("File is corrupted, invalid zone map header");
+        }
+        for (auto& table : result.relations) {
+            for (auto& column : table.columns) {
+                auto start = read(engine::type_identity<uint64_t>());
+                if (start % alignof(ZoneMap) != 0 || start + column.pages.size() * sizeof(ZoneMap) > result.fileMapping.size()) {
+                    throw std::runtime_error("File is corrupted, zone maps out of bounds");
+                }
+                column.zoneMaps = {reinterpret_cast<const ZoneMap*>(result.fileMapping.data() + start), column.pages.size()};
+            }
+        }
+
+        // Load the dictionaries if the file contains them
+        auto dictionaryHeader = read(engine::type_identity<DictionaryHeader>());
+        if (dictionaryHeader.marker == DictionaryHeader::markerValue) {
+            if (dictionaryHeader.numColumns != numColumns) {
+                throw std::runtime_error("File is corrupted, invalid dictionary header");
+            }
+            for (auto& table : result.relations) {
+                for (auto& column : table.columns) {
+                    auto start = read(engine::type_identity<uint64_t>());
+                    if (!start)
+                        continue;
+                    uint64_t count;
+                    if (column.type != DataType::VARCHAR || start + sizeof(count) > result.fileMapping.size()) {
+                        throw std::runtime_error("File is corrupted, invalid dictionary");
+                    }
+                    memcpy(&count, result.fileMapping.data() + start, sizeof(count));
+                    auto* offsets = reinterpret_cast<const uint32_t*>(result.fileMapping.data() + start + sizeof(count));
+                    auto* strings = reinterpret_cast<const char*>(offsets + count);
+                    if (!count || count > maxDictionarySize || start + sizeof(count) + count * sizeof(uint32_t) > result.fileMapping.size() || strings + offsets[count - 1] > result.fileMapping.data() + result.fileMapping.size()) {
+                        throw std::runtime_error("File is corrupted, dictionary out of bounds");
+                    }
+                    column.dictionaryStorage.reserve(count);
+                    for (uint64_t i = 0, begin = 0; i < count; begin = offsets[i++])
+                        column.dictionaryStorage.push_back(StringPtr::fromString(strings + begin, offsets[i] - begin).val());
+                    column.dictionary = column.dictionaryStorage;
+                }
+            }
+
+            // Mark the bit packed columns if the file contains them
+            auto bitPackingHeader = read(engine::type_identity<BitPackingHeader>());
+            if (bitPackingHeader.marker == BitPackingHeader::markerValue) {
+                if (bitPackingHeader.numColumns != numColumns) {
+                    throw std::runtime_error("File is corrupted, invalid bit packing header");
+                }
+                for (auto& table : result.relations) {
+                    for (auto& column : table.columns) {
+                        auto bitPacked = read(engine::type_identity<uint64_t>());
+                        if (bitPacked > 1 || (bitPacked && column.type != DataType::INT32 && !column.isDictionaryEncoded())) {
+                            throw std::runtime_error("File is corrupted, invalid bit packing");
+                        }
+                        column.bitPacked = bitPacked;
+                    }
+                }
+
+                // Copy the statistics from the header if the file contains them
+                if (cur + sizeof(StatisticsHeader) / sizeof(uint64_t) > headerEnd)
+                    return result;
+                auto statisticsHeader = read(engine::type_identity<StatisticsHeader>());
+                if (statisticsHeader.marker == StatisticsHeader::markerValue) {
+                    if (statisticsHeader.numColumns != numColumns) {
+                        throw std::runtime_error("File is corrupted, invalid statistics header");
+                    }
+                    for (auto& table : result.relations) {
+                        for (auto& column : table.columns) {
+                            auto statistics = read(engine::type_identity<ColumnStatistics>());
+                            if (statistics.numRows > table.numRows || statistics.numNulls > statistics.numRows) {
+                                throw std::runtime_error("File is corrupted, invalid statistics");
+                            }
+                            if (statistics.isKnown())
+                                column.statistics = statistics;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
     return result;
 }
 //---------------------------------------------------------------------------
+void DataSource::willNeed(engine::span<Page* const> pages) {
+    for (size_t begin = 0, end; begin < pages.size(); begin = end) {
+        for (end = begin + 1; end < pages.size() && pages[end] == pages[end - 1] + 1; end++);
+        Mmap::willNeed(pages[begin], (end - begin) * sizeof(Page));
+    }
+}
+//---------------------------------------------------------------------------
 }
@@ -2,6 +2,9 @@
 //---------------------------------------------------------------------------
 #include "infra/Mmap.hpp"
 #include "infra/helper/Span.hpp"
+#include "storage/ColumnStatistics.hpp"
+#include <atomic>
+#include <optional>
 #include <span>
 #include <vector>
 #include <attribute.h>
@@ -83,19 +86,75 @@ struct DataSource {
     struct Header;
     struct TableHeader;
     struct ColumnHeader;
+    struct ZoneMapHeader;
+    struct DictionaryHeader;
+    struct BitPackingHeader;
+    struct StatisticsHeader;
+
+    /// The value range of the non-null values of a page. Pages without any non-null value have min > max
+    struct ZoneMap {
+        /// The minimum and maximum, INT32 and INT64 values compare unsigned, strings compare by their stringKey
+        uint64_t min, max;
+
+        /// Can the page contain any non-null value?
+        bool hasValues() const { return min <= max; }
+        /// Does the range intersect [lower, upper]?
+        bool intersects(uint64_t lower, uint64_t upper) const { return (lower <= max) && (min <= upper); }
+        /// The order preserving key of a string, i.e., its first 8 bytes in big-endian order padded with zeros
+        static uint64_t stringKey(const char* str, size_t len);
+        /// Compute the zone map of a page, the values of bit packed pages compare like INT32 values
+        static ZoneMap compute(DataType type, const Page& page, bool bitPacked = false);
+    };
+
+    /// The number of leading pages of a mapped column that were already read ahead. Copies of a column start over
+    struct ReadAheadMark {
+        mutable std::atomic<size_t> pages = 0;
+
+        ReadAheadMark() = default;
+        ReadAheadMark(const ReadAheadMark&) {}
+        ReadAheadMark& operator=(const ReadAheadMark&) { return *this; }
+    };
 
     struct Column {
         DataType type;
         engine::span<Page* const> pages;
         std::vector<Page*> pagesStorage;
+        /// The zone maps of the pages, empty if unknown
+        engine::span<const ZoneMap> zoneMaps = {};
+        /// The StringPtr values of the sorted distinct strings if the VARCHAR column is dictionary encoded. The pages then contain the INT32 codes
+        engine::span<const uint64_t> dictionary = {};
+        std::vector<uint64_t> dictionaryStorage = {};
+        /// Are the pages bit packed, see BitPacking? Only INT32 and dictionary encoded columns can be bit packed
+        bool bitPacked = false;
+        /// Do the pages live in the file mapping? Their first access may then fault
+        bool mapped = false;
+        /// The pages that were read ahead, only used for mapped columns
+        ReadAheadMark readAhead = {};
+        /// The statistics of the column, if known
+        std::optional<ColumnStatistics> statistics;
+
+        /// Is the column dictionary encoded?
+        bool isDictionaryEncoded() const { return !dictionary.empty(); }
+    };
+    /// A random sample of the rows of a table, shared by all queries on the table
+    struct Sample {
+        /// The sampled rows, one random row of each of the equally sized strata. Hence, they are sorted
+        std::vector<uint64_t> rowIds;
+        /// The sampled values of the 32 bit columns, padded with nulls to a multiple of 64 values. Empty if the column was not sampled yet
+        std::vector<std::vector<uint32_t>> columns;
     };
     struct Table {
         uint64_t numRows;
         std::vector<Column> columns;
         std::string name;
+        /// The sample, created on demand by the query planning
+        Sample sample = {};
         static constexpr size_t nameLenLimit = 1024 - 3 * sizeof(uint64_t);
         static std::string fixName(std::string name);
     };
+    /// The maximum number of distinct values of a dictionary encoded column
+    static constexpr size_t maxDictionarySize = 1ull << 16;
+
     /// The vector of relations
     std::vector<Table> relations;
     /// File mapping
@@ -103,6 +162,8 @@ struct DataSource {
 
     void serialize(const std::string& filename) &&;
     static DataSource deserialize(const std::string& filename);
+    /// Hint that the pages will be read soon. Issues one hint per run of consecutive pages
+    static void willNeed(engine::span<Page* const> pages);
 };
 //---------------------------------------------------------------------------
 }
@@ -11,15 +11,18 @@ struct PlanImporter {
     DataSource& dataSource;
     QueryPlan& result;
     const Plan& plan;
+    engine::span<const PlanImport::ScanFilter> filters;
     UnionFind attrGroups;
     size_t attrCount = 0;
+    /// The attributes the filters are applied to
+    SmallVec<std::pair<unsigned, const PlanImport::ScanFilter*>> filterAttrs;
 
     struct Subtree {
         SmallVec<unsigned> attributes;
     };
 
-    PlanImporter(DataSource& ds, QueryPlan& r, const Plan& p)
-        : dataSource(ds), result(r), plan(p) {}
+    PlanImporter(DataSource& ds, QueryPlan& r, const Plan& p, engine::span<const PlanImport::ScanFilter> f)
+        : dataSource(ds), result(r), plan(p), filters(f) {}
 
     Subtree rec(const PlanNode& n) {
         Subtree s;
@@ -50,6 +53,21 @@ struct PlanImporter {
                 result.addAttribute(scan->base_table_id, idx, dt);
                 attrCount++;
             }
+            // Filtered columns that are not produced get an attribute of their own
+            unsigned node = &n - plan.nodes.data();
+            for (auto& filter : filters) {
+                if (filter.node != node)
+                    continue;
+                auto it = std::find_if(n.output_attrs.begin(), n.output_attrs.end(), [&](auto& a) { return std::get<0>(a) == filter.column; });
+                if (it != n.output_attrs.end()) {
+                    filterAttrs.emplace_back(s.attributes[it - n.output_attrs.begin()], &filter);
+                } else if (!fillTable) {
+                    attrs.insert(attrCount);
+                    result.addAttribute(scan->base_table_id, filter.column, tbl->columns[filter.column].type);
+                    filterAttrs.emplace_back(attrCount, &filter);
+                    attrCount++;
+                }
+            }
             assert(tbl);
             result.addInput(*tbl, attrs);
         }
@@ -59,11 +77,11 @@ struct PlanImporter {
 //-------------------------------------------------------------------------
 }
 //---------------------------------------------------------------------------
-QueryPlan PlanImport::importPlanExistingData(DataSource& dataSource, const Plan& plan) {
+QueryPlan PlanImport::importPlanExistingData(DataSource& dataSource, const Plan& plan, engine::span<const ScanFilter> filters, bool distinct) {
     using namespace std;
     QueryPlan result{dataSource};
 
-    PlanImporter importer(dataSource, result, plan);
+    PlanImporter importer(dataSource, result, plan, filters);
 
     auto res = importer.rec(plan.nodes[plan.root]);
 
@@ -78,16 +96,45 @@ QueryPlan PlanImport::importPlanExistingData(DataSource& dataSource, const Plan&
         equivalenceSets.push_back(v);
 
     result.prepare(std::move(equivalenceSets));
+    for (auto& [attr, filter] : importer.filterAttrs) {
+        Restriction restriction = filter->restriction;
+        restriction.pattern = filter->pattern;
+        restriction.values = filter->values;
+        result.addFilter(attr, restriction);
+    }
 
     SmallVec<unsigned> attrs;
     attrs.reserve(res.attributes.size());
     for (unsigned a : res.attributes)
         attrs.push_back(a);
-    result.setOutput(attrs);
+    result.setOutput(attrs, distinct);
 
     return result;
 }
 //---------------------------------------------------------------------------
+void PlanImport::warmUp(const DataSource& dataSource, const Plan& plan, engine::span<const ScanFilter> filters) {
+    auto warmUpColumn = [&](const DataSource::Table& table, size_t column) {
+        if (column >= table.columns.size() || !table.columns[column].mapped)
+            return;
+        // Like the table scan, only hint columns that were not completely read ahead before
+        auto& col = table.columns[column];
+        if (col.readAhead.pages.exchange(col.pages.size()) < col.pages.size())
+            DataSource::willNeed(col.pages);
+    };
+    for (auto& n : plan.nodes) {
+        auto* scan = std::get_if<ScanNode>(&n.data);
+        if (!scan)
+            continue;
+        auto& table = dataSource.relations[scan->base_table_id];
+        for (auto [idx, dt] : n.output_attrs)
+            warmUpColumn(table, idx);
+        unsigned node = &n - plan.nodes.data();
+        for (auto& filter : filters)
+            if (filter.node == node)
+                warmUpColumn(table, filter.column);
+    }
+}
+//---------------------------------------------------------------------------
 DataSource::Table PlanImport::importTable(const ColumnarTable& input) {
     DataSource::Table table;
     table.numRows = input.num_rows;
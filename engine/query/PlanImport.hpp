@@ -2,6 +2,8 @@
 //---------------------------------------------------------------------------
 #include "query/QueryPlan.hpp"
 #include <memory>
+#include <string>
+#include <vector>
 //---------------------------------------------------------------------------
 struct Plan;
 struct ColumnarTable;
@@ -9,8 +11,25 @@ struct ColumnarTable;
 namespace engine {
 //---------------------------------------------------------------------------
 struct PlanImport {
-    static QueryPlan importPlanExistingData(DataSource& dataSource, const Plan& plan);
+    /// A filter on a column of a scanned table that is evaluated by the table scan
+    struct ScanFilter {
+        /// The scan node
+        unsigned node;
+        /// The column within the scanned table, must be an INT32, FP64, or VARCHAR column
+        unsigned column;
+        /// The restriction, either Range, In, or NotNull for integers, DoubleRange or NotNull for doubles, or a string restriction for strings
+        Restriction restriction;
+        /// The string compared with by string restrictions
+        std::string pattern;
+        /// The sorted values of an In restriction
+        std::vector<uint64_t> values;
+    };
+
+    /// Import a plan over the tables of the data source. With distinct set, duplicate output tuples are eliminated
+    static QueryPlan importPlanExistingData(DataSource& dataSource, const Plan& plan, engine::span<const ScanFilter> filters = {}, bool distinct = false);
     static QueryPlan importPlan(DataSource& dataSource, const Plan& plan);
+    /// Hint that the mapped columns that the plan scans will be read soon
+    static void warmUp(const DataSource& dataSource, const Plan& plan, engine::span<const ScanFilter> filters = {});
 
     static DataSource::Table importTable(const ColumnarTable& tbl);
 
@@ -1,17 +1,19 @@
 #include "query/QueryGraph.hpp"
+#include "infra/Scheduler.hpp"
+#include "query/CostModel.hpp"
 #include "query/DPccp.hpp"
 #include "query/QueryPlan.hpp"
+#include <algorithm>
 #include <cmath>
+#include <stdexcept>
 //---------------------------------------------------------------------------
 namespace engine {
 //---------------------------------------------------------------------------
-QueryGraph::QueryGraph(QueryPlan& qp, SmallVec<Input> inputs) : qp(qp), inputs(std::move(inputs)), plans(1ull << qp.inputs.size()) {
-    for (size_t i = 0; i < plans.size(); i++) {
-        for (size_t p = 0; p < maxPipelineLength; p++) {
-            plans[i][p].set = BitSet::fromU64(i);
-            plans[i][p].pipes = p;
-        }
-    }
+QueryGraph::QueryGraph(QueryPlan& qp, SmallVec<Input> inputs) : qp(qp), inputs(std::move(inputs)) {
+    if (qp.inputs.size() >= 64)
+        throw std::runtime_error("too many relations to join");
+    // A chain or star has a few sets per relation, a clique has many more but is enumerated lazily anyway
+    plans.reserve(4 * qp.inputs.size() * qp.inputs.size());
 }
 //---------------------------------------------------------------------------
 size_t QueryGraph::size() const { return qp.inputs.size(); }
@@ -25,26 +27,30 @@ BitSet QueryGraph::computeNeighborhood(BitSet rels, BitSet eqs) const {
 }
 //---------------------------------------------------------------------------
 BitSet QueryGraph::neighborhood(BitSet bs) const {
-    if (plans[bs.asU64()][0].eqs.empty()) {
+    auto it = plans.find(bs.asU64());
+    if (it == plans.end() || it->second[0].eqs.empty()) {
         BitSet eqs;
         for (unsigned r : bs)
             eqs += inputs[r].producedEq;
         return computeNeighborhood(bs, eqs);
     }
-    return plans[bs.asU64()][0].neighborhood;
+    return it->second[0].neighborhood;
 }
 //---------------------------------------------------------------------------
 bool QueryGraph::connected(BitSet bs) const {
-    if (plans[bs.asU64()][0].card == -1)
+    auto it = plans.find(bs.asU64());
+    if (it == plans.end() || it->second[0].card == -1)
         return false;
-    for (size_t i = 0; i < size(); i++)
-        if (plans[bs.asU64()][i].cost < std::numeric_limits<double>::infinity())
+    for (size_t i = 0; i < maxPipelineLength; i++)
+        if (it->second[i].cost < std::numeric_limits<double>::infinity())
             return true;
     return false;
 }
 //---------------------------------------------------------------------------
-double QueryGraph::computeCost(double card, double leftCard, [[maybe_unused]] double rightCard) {
-    auto res = card + leftCard * 10;
+double QueryGraph::computeCost(double card, double leftCard, double rightCard) {
+    // The left side is built into a hash table that the right side probes
+    auto& model = CostModel::get();
+    auto res = card + leftCard * model.build + rightCard * model.probeCost(leftCard);
     assert(std::isfinite(res));
     return res;
 }
@@ -61,18 +67,53 @@ double QueryGraph::computeCard(BitSet rels) {
     return card * mult;
 }
 //---------------------------------------------------------------------------
+double QueryGraph::estimateDistinct(BitSet rels, unsigned eq) const {
+    // A join only keeps the values that occur in all of its inputs
+    double result = std::numeric_limits<double>::infinity();
+    for (unsigned u : rels) {
+        if (!inputs[u].producedEq.contains(eq))
+            continue;
+        auto it = std::find_if(inputs[u].distinctValues.begin(), inputs[u].distinctValues.end(), [&](auto& entry) { return entry.first == eq; });
+        if (it == inputs[u].distinctValues.end())
+            return std::numeric_limits<double>::infinity();
+        result = std::min(result, it->second);
+    }
+    return result;
+}
+//---------------------------------------------------------------------------
 /// Compute cardinality
 void QueryGraph::computeCard(Plan& target, const Plan& left, const Plan& right) {
+    // Without statistics, a join is assumed to be a key/foreign key join that does not exceed its larger input
     target.bc = std::max(left.bc, right.bc);
+    // With statistics, every join class contributes 1 / max(d(left), d(right)), an input cannot have more distinct values than tuples
+    auto joinEqs = left.eqs & right.eqs;
+    double card = left.card * right.card;
+    bool known = !joinEqs.empty();
+    for (unsigned eq : joinEqs) {
+        double leftDistinct = estimateDistinct(left.set, eq), rightDistinct = estimateDistinct(right.set, eq);
+        if (!std::isfinite(leftDistinct) || !std::isfinite(rightDistinct)) {
+            known = false;
+            break;
+        }
+        card /= std::max({std::min(leftDistinct, left.card), std::min(rightDistinct, right.card), 1.0});
+    }
+    if (known)
+        target.bc = card;
+    // Join sampling beats any estimate from the inputs
+    if (auto it = sampledCards.find(target.set.asU64()); it != sampledCards.end())
+        target.bc = it->second;
     target.card = target.bc;
 }
 //---------------------------------------------------------------------------
 void QueryGraph::consider(BitSet left, BitSet right) {
-    auto tot = left + right;
-    double baseCost = computeCost(get(tot, 0).card, get(left, 0).card, get(right, 0).card);
+    consider(left, right, getPlans(left + right));
+}
+//---------------------------------------------------------------------------
+void QueryGraph::consider(BitSet left, BitSet right, PlanSet& targets) {
+    double baseCost = computeCost(targets[0].card, get(left, 0).card, get(right, 0).card);
     for (size_t rpipes = 0; rpipes < maxPipelineLength - 1; rpipes++) {
         auto& rplan = get(right, rpipes);
-        auto& target = get(tot, rpipes + 1);
+        auto& target = targets[rpipes + 1];
         if (rplan.cost >= target.cost)
             continue;
         double bound = target.cost - (rplan.cost + baseCost);
@@ -104,79 +145,205 @@ bool QueryGraph::canJoin(BitSet left, BitSet right) {
     return true;
 }
 //---------------------------------------------------------------------------
-QueryGraph::Plan* QueryGraph::optimize() {
-    // Setup base relations
-    for (unsigned i = 0; i < qp.inputs.size(); i++) {
-        auto& p = plans[BitSet{i}.asU64()][0];
-        p.eqs = inputs[i].producedEq;
-        p.neighborhood = computeNeighborhood(p.set, p.eqs);
-        p.bc = inputs[i].cardinality;
-        p.card = inputs[i].cardinality;
-        // Not sure we can do any kind of view matching but just to be safe, give cost to base relations
-        p.cost = p.card;
+void QueryGraph::setupJoin(PlanSet& target, BitSet left, BitSet right) {
+    auto& base = target[0];
+    base.eqs = get(left, 0).eqs + get(right, 0).eqs;
+    computeCard(base, get(left, 0), get(right, 0));
+    base.neighborhood = computeNeighborhood(base.set, base.eqs);
+    for (size_t i = 1; i < maxPipelineLength; i++) {
+        target[i].eqs = base.eqs;
+        target[i].card = base.card;
+        target[i].neighborhood = base.neighborhood;
     }
+}
+//---------------------------------------------------------------------------
+void QueryGraph::considerPair(PlanSet& tot, BitSet left, BitSet right) {
+    if (tot[0].card == -1)
+        setupJoin(tot, left, right);
+    bool lr = canJoin(left, right);
+    bool rl = canJoin(right, left);
+    if (lr)
+        consider(left, right, tot);
+    if (rl)
+        consider(right, left, tot);
+}
+//---------------------------------------------------------------------------
+bool QueryGraph::enumerateParallel() {
+    // The pure join graph, every enumerated subgraph is connected. Whether a set has a valid plan is only known once the smaller sets are optimized
+    struct JoinGraph {
+        const QueryGraph& qg;
+        BitSet neighborhood(BitSet bs) const { return qg.neighborhood(bs); }
+        bool connected(BitSet) const { return true; }
+        size_t size() const { return qg.size(); }
+    };
+    struct Pair {
+        BitSet left, right;
+        BitSet tot() const { return left + right; }
+    };
 
-    // Compute optimal plan
-    DPccp::enumerateCsgCmp(*this, [&](BitSet left, BitSet right) -> void {
-        assert(get(left, 0).card >= 0);
-        assert(get(left, 0).card < std::numeric_limits<double>::infinity());
-        assert(get(right, 0).card >= 0);
-        assert(get(right, 0).card < std::numeric_limits<double>::infinity());
-        auto tot = left + right;
-
-        auto& totBase = get(tot, 0);
-        if (totBase.card == -1) {
-            totBase.eqs = get(left, 0).eqs + get(right, 0).eqs;
-            computeCard(totBase, get(left, 0), get(right, 0));
-            totBase.neighborhood = computeNeighborhood(tot, totBase.eqs);
-            for (size_t i = 1; i < maxPipelineLength; i++) {
-                auto& totPlan = get(tot, i);
-                totPlan.eqs = totBase.eqs;
-                totPlan.card = totBase.card;
-                totPlan.neighborhood = totBase.neighborhood;
-            }
+    // Collect all csg-cmp pairs
+    Vector<Pair> pairs;
+    bool overflow = false;
+    DPccp::enumerateCsgCmp(JoinGraph{*this}, [&](BitSet left, BitSet right) -> void {
+        if (pairs.size() >= maxParallelPairs) {
+            overflow = true;
+            return;
         }
-        bool lr = canJoin(left, right);
-        bool rl = canJoin(right, left);
-        if (lr)
-            consider(left, right);
-        if (rl)
-            consider(right, left);
+        pairs.push_back({left, right});
     });
+    if (overflow)
+        return false;
 
-    auto full = BitSet::prefix(qp.inputs.size());
+    // Order the pairs by the size of the joined set, a pair only depends on pairs of smaller sets
+    std::stable_sort(pairs.begin(), pairs.end(), [](const Pair& a, const Pair& b) {
+        auto at = a.tot(), bt = b.tot();
+        return (at.size() != bt.size()) ? (at.size() < bt.size()) : (at.asU64() < bt.asU64());
+    });
 
-    for (size_t i = 0; i < maxPipelineLength; i++) {
-        if (get(full, i).cost < get(full, bestPipes).cost)
-            bestPipes = i;
+    // The pairs of every joined set form a task, all plans are created upfront so that the workers only look them up
+    Vector<size_t> groups;
+    for (size_t i = 0; i < pairs.size(); i++) {
+        if (i == 0 || pairs[i].tot() != pairs[i - 1].tot()) {
+            groups.push_back(i);
+            getPlans(pairs[i].tot());
+        }
     }
+    groups.push_back(pairs.size());
 
-    // Handle cross products
-    if (get(full, bestPipes).cost == std::numeric_limits<double>::infinity()) {
-        SmallVec<BitSet> componentSets;
-        BitSet remaining = full;
-        while (!remaining.empty()) {
-            if (connected(remaining)) {
-                componentSets.push_back(remaining);
-                break;
+    // Optimize level by level, the sets of one level are independent of each other
+    for (size_t levelBegin = 0; levelBegin + 1 < groups.size();) {
+        size_t levelEnd = levelBegin + 1;
+        unsigned levelSize = pairs[groups[levelBegin]].tot().size();
+        while (levelEnd + 1 < groups.size() && pairs[groups[levelEnd]].tot().size() == levelSize)
+            levelEnd++;
+        Scheduler::parallelFor(levelBegin, levelEnd, [&](size_t, size_t group) {
+            auto& tot = plans.find(pairs[groups[group]].tot().asU64())->second;
+            for (size_t i = groups[group]; i < groups[group + 1]; i++) {
+                auto [left, right] = pairs[i];
+                if (connected(left) && connected(right))
+                    considerPair(tot, left, right);
             }
-            for (BitSet sub : remaining.subsets()) {
-                // We should exit the loop before nothing is left
-                assert(sub != remaining);
-                auto set = remaining - sub;
-                if (!connected(set))
-                    continue;
+        });
+        levelBegin = levelEnd;
+    }
+    return true;
+}
+//---------------------------------------------------------------------------
+SmallVec<BitSet> QueryGraph::optimizeExact() {
+    // Compute optimal plan, medium sized graphs are enumerated in parallel
+    if (size() < minParallelInputs || !enumerateParallel()) {
+        DPccp::enumerateCsgCmp(*this, [&](BitSet left, BitSet right) -> void {
+            assert(get(left, 0).card >= 0);
+            assert(get(left, 0).card < std::numeric_limits<double>::infinity());
+            assert(get(right, 0).card >= 0);
+            assert(get(right, 0).card < std::numeric_limits<double>::infinity());
+            considerPair(getPlans(left + right), left, right);
+        });
+    }
+
+    auto full = BitSet::prefix(qp.inputs.size());
+    if (connected(full))
+        return {full};
+
+    // Split into the largest connected components
+    SmallVec<BitSet> componentSets;
+    BitSet remaining = full;
+    while (!remaining.empty()) {
+        if (connected(remaining)) {
+            componentSets.push_back(remaining);
+            break;
+        }
+        for (BitSet sub : remaining.subsets()) {
+            // We should exit the loop before nothing is left
+            assert(sub != remaining);
+            auto set = remaining - sub;
+            if (!connected(set))
+                continue;
 
-                // We found the largest subset of remaining that is connected
-                // This set may not intersect with any of the existing components
-                assert(std::all_of(componentSets.begin(), componentSets.end(), [&](const BitSet& c) {
-                    return !c.intersectsWith(set);
-                }));
-                componentSets.push_back(set);
-                remaining -= set;
+            // We found the largest subset of remaining that is connected
+            // This set may not intersect with any of the existing components
+            assert(std::all_of(componentSets.begin(), componentSets.end(), [&](const BitSet& c) {
+                return !c.intersectsWith(set);
+            }));
+            componentSets.push_back(set);
+            remaining -= set;
+        }
+    }
+    return componentSets;
+}
+//---------------------------------------------------------------------------
+SmallVec<BitSet> QueryGraph::optimizeGreedy() {
+    SmallVec<BitSet> components;
+    for (unsigned i = 0; i < qp.inputs.size(); i++)
+        components.push_back(BitSet{i});
+
+    while (components.size() > 1) {
+        // Find the join with the smallest result, ties are broken by cost
+        PlanSet best;
+        size_t bestLeft = 0, bestRight = 0;
+        double bestCost = std::numeric_limits<double>::infinity();
+        for (size_t a = 0; a < components.size(); a++) {
+            for (size_t b = a + 1; b < components.size(); b++) {
+                auto left = components[a], right = components[b];
+                bool lr = canJoin(left, right);
+                bool rl = canJoin(right, left);
+                if (!lr && !rl)
+                    continue;
+                PlanSet candidate;
+                for (size_t p = 0; p < maxPipelineLength; p++) {
+                    candidate[p].set = left + right;
+                    candidate[p].pipes = p;
+                }
+                setupJoin(candidate, left, right);
+                if (lr)
+                    consider(left, right, candidate);
+                if (rl)
+                    consider(right, left, candidate);
+                double cost = std::numeric_limits<double>::infinity();
+                for (auto& plan : candidate)
+                    cost = std::min(cost, plan.cost);
+                if (cost == std::numeric_limits<double>::infinity())
+                    continue;
+                if (bestCost == std::numeric_limits<double>::infinity() || candidate[0].card < best[0].card || (candidate[0].card == best[0].card && cost < bestCost)) {
+                    best = candidate;
+                    bestLeft = a;
+                    bestRight = b;
+                    bestCost = cost;
+                }
             }
         }
+        // The remaining components can only be combined by cross products
+        if (bestCost == std::numeric_limits<double>::infinity())
+            break;
+        getPlans(best[0].set) = best;
+        components[bestLeft] = best[0].set;
+        components[bestRight] = components.back();
+        components.pop_back();
+    }
+    return components;
+}
+//---------------------------------------------------------------------------
+void QueryGraph::setupBaseRelations() {
+    for (unsigned i = 0; i < qp.inputs.size(); i++) {
+        auto& p = get(BitSet{i}, 0);
+        p.eqs = inputs[i].producedEq;
+        p.neighborhood = computeNeighborhood(p.set, p.eqs);
+        p.bc = inputs[i].cardinality;
+        p.card = inputs[i].cardinality;
+        // Not sure we can do any kind of view matching but just to be safe, give cost to base relations
+        p.cost = p.card;
+    }
+}
+//---------------------------------------------------------------------------
+QueryGraph::Plan* QueryGraph::optimize() {
+    setupBaseRelations();
+
+    // Large graphs have too many connected subgraphs for an exact enumeration
+    auto componentSets = (qp.inputs.size() <= maxExactInputs) ? optimizeExact() : optimizeGreedy();
+    auto full = BitSet::prefix(qp.inputs.size());
 
+    // Handle cross products
+    if (componentSets.size() > 1) {
         std::sort(componentSets.begin(), componentSets.end(), [&](const BitSet& a, const BitSet& b) {
             // Both sides cannot be a hash table as we only allow one cross product hash table at a time
             assert(!(a.single() && inputs[a.front()].joinKey != ~0u) || !(b.single() && inputs[b.front()].joinKey != ~0u));
@@ -20,6 +20,8 @@ struct QueryGraph {
         double multiplicity = 1.0;
         /// The key that needs to be joined with
         unsigned joinKey = ~0u;
+        /// The estimated number of distinct values per equivalence class, only known for base tables with column statistics
+        SmallVec<std::pair<unsigned, double>> distinctValues = {};
     };
     struct Plan {
         Plan* left = nullptr;
@@ -38,15 +40,25 @@ struct QueryGraph {
 
     /// The maximum number of pipes in a plan
     static constexpr size_t maxPipelineLength = 3;
+    /// The maximum number of inputs that are optimized exactly with DPccp, larger graphs are ordered greedily
+    static constexpr size_t maxExactInputs = 18;
+    /// The minimum number of inputs for which DPccp is enumerated in parallel, smaller graphs are optimized faster than a parallel task is scheduled
+    static constexpr size_t minParallelInputs = 10;
+    /// The maximum number of csg-cmp pairs that are collected for the parallel enumeration, denser graphs are enumerated sequentially
+    static constexpr size_t maxParallelPairs = 1ull << 22;
+    /// The plans of a set of relations, one per number of pipes
+    using PlanSet = std::array<Plan, maxPipelineLength>;
 
     /// Reference to the query plan
     QueryPlan& qp;
     /// The inputs
     SmallVec<Input> inputs;
-    /// The plans
-    Vector<std::array<Plan, maxPipelineLength>> plans;
+    /// The plans, keyed by their set. Only the considered sets are stored, the entries are stable as plans point to each other
+    UnorderedMap<uint64_t, PlanSet> plans;
     /// The number of pipes of the best plan
     size_t bestPipes = 0;
+    /// The cardinalities of relation sets that were estimated by join sampling, keyed by the set
+    UnorderedMap<uint64_t, double> sampledCards;
 
     explicit QueryGraph(QueryPlan& qp, SmallVec<Input> inputs);
 
@@ -57,23 +69,49 @@ struct QueryGraph {
     bool connected(BitSet bs) const;
     bool canJoin(BitSet left, BitSet right);
     void consider(BitSet left, BitSet right);
-    static double computeCost(double card, double leftCard, [[maybe_unused]] double rightCard);
+    /// Consider joining left and right into the given plans of their union
+    void consider(BitSet left, BitSet right, PlanSet& target);
+    static double computeCost(double card, double leftCard, double rightCard);
 
+    /// Get the plans of a set, an unknown set gets empty plans. Known sets are only looked up, which is safe during the parallel enumeration
+    PlanSet& getPlans(BitSet bs) {
+        if (auto it = plans.find(bs.asU64()); it != plans.end())
+            return it->second;
+        auto& result = plans[bs.asU64()];
+        for (size_t p = 0; p < maxPipelineLength; p++) {
+            result[p].set = bs;
+            result[p].pipes = p;
+        }
+        return result;
+    }
     /// Get a plan
     [[gnu::always_inline]] Plan& get(BitSet bs, size_t pipes) {
         assert(pipes < maxPipelineLength);
-        assert(bs.asU64() < plans.size());
-        auto& result = plans[bs.asU64()][pipes];
+        auto& result = getPlans(bs)[pipes];
         assert(result.set == bs);
         assert(result.pipes == pipes);
         return result;
     }
 
+    /// Estimate the number of distinct values of an equivalence class in a set of relations, infinity if unknown
+    double estimateDistinct(BitSet rels, unsigned eq) const;
     /// Compute cardinality
     double computeCard(BitSet rels);
     /// Compute cardinality
     void computeCard(Plan& target, const Plan& left, const Plan& right);
+    /// Setup the plans of the union of left and right, i.e., their classes, cardinality and neighborhood
+    void setupJoin(PlanSet& target, BitSet left, BitSet right);
 
+    /// Setup the plans of the base relations
+    void setupBaseRelations();
+    /// Consider both join directions of a csg-cmp pair for the plans of their union
+    void considerPair(PlanSet& tot, BitSet left, BitSet right);
+    /// Enumerate the csg-cmp pairs in parallel, one level of set sizes at a time. Returns false if the graph has too many pairs
+    bool enumerateParallel();
+    /// Enumerate all connected subgraphs with DPccp and return the connected components if the graph is not connected
+    SmallVec<BitSet> optimizeExact();
+    /// Greedy operator ordering, repeatedly join the two plans with the smallest result. Returns the remaining components
+    SmallVec<BitSet> optimizeGreedy();
     Plan* optimize();
 };
 //---------------------------------------------------------------------------
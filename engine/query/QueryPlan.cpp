@@ -1,4 +1,5 @@
 #include "query/QueryPlan.hpp"
+#include "infra/Random.hpp"
 #include "infra/Scheduler.hpp"
 #include "infra/SmallVec.hpp"
 #include "op/CollectorTarget.hpp"
@@ -6,9 +7,17 @@
 #include "op/TableScan.hpp"
 #include "op/TableTarget.hpp"
 #include "pipeline/PipelineFunction.hpp"
+#include "query/CostModel.hpp"
 #include "query/QueryGraph.hpp"
+#include "query/SharedBuilds.hpp"
+#include "storage/ColumnStatistics.hpp"
 #include "storage/RestrictionLogic.hpp"
+#include "storage/StringRestrictionLogic.hpp"
+#include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <mutex>
+#include <unordered_map>
 #include <plan.h>
 //---------------------------------------------------------------------------
 namespace engine {
@@ -30,7 +39,9 @@ struct QueryPlan::Input {
     double cardinality = 1.0;
 
     /// The hash table
-    UniquePtr<Hashtable> ht;
+    Hashtable* ht = nullptr;
+    /// The storage of the hash table, unless the hash table is shared within a batch
+    UniquePtr<Hashtable> htStorage;
     /// The hash table build
     UniquePtr<HashtableBuild> htBuild;
     /// The restriction based on this hash table
@@ -54,21 +65,28 @@ struct QueryPlan::Input {
     DataSource::Table* table = nullptr;
     /// The table info
     TableScan::TableInfo tableInfo;
-    /// Random sample of up to 64 rows, columnwise. These may only be uint32_t attributes
-    Vector<uint32_t> sample;
-    /// Eq class to sample column
-    UnorderedMap<unsigned, unsigned> sampleOffsets;
-    /// The size of the sample
-    size_t sampleSize = 0;
-    /// The currently matching tuples in the sample
-    uint64_t sampleMatches = ~0ull;
+    /// The sample of the table, nullptr if not computed yet
+    const DataSource::Sample* sample = nullptr;
+    /// Eq class to the sampled values, see DataSource::Sample::columns. These may only be uint32_t attributes
+    UnorderedMap<unsigned, const uint32_t*> sampleColumns;
+    /// The currently matching tuples in the sample, one bit per sampled row
+    Vector<uint64_t> sampleMatches;
+    /// The selectivity of the pushed down filters according to the column statistics, used if no sampled row matches
+    double statisticsSelectivity = 1.0;
 
+    /// The number of sampled rows
+    size_t getSampleSize() const { return sample->rowIds.size(); }
+    /// Compute the selectivity from the matching tuples of the sample. If none matches, the fallback is bounded by half a sampled row
+    double getSampleSelectivity(const uint64_t* matches, double fallback = 1.0) const {
+        size_t count = 0;
+        for (size_t i = 0; i < sampleMatches.size(); i++)
+            count += engine::popcount(matches[i]);
+        return count ? double(count) / getSampleSize() : std::min(fallback, 1.0 / (getSampleSize() * 2));
+    }
     /// Recompute cardinality from sample
     void recomputeCardinality() {
         assert(isBase());
-        auto matches = engine::popcount(sampleMatches);
-        double selectivity = matches ? double(matches) / sampleSize : (1.0 / (sampleSize * 2));
-        cardinality = table->numRows * selectivity;
+        cardinality = std::max(table->numRows * getSampleSelectivity(sampleMatches.data(), statisticsSelectivity), 0.5);
     }
 
     /// Is this a base table or hash table?
@@ -95,6 +113,31 @@ QueryPlan::~QueryPlan() noexcept = default;
 QueryPlan::QueryPlan(QueryPlan&& other) noexcept = default;
 QueryPlan& QueryPlan::operator=(QueryPlan&& other) noexcept = default;
 //---------------------------------------------------------------------------
+/// The maximum number of sampled rows per table
+static constexpr size_t maxSampleSize = 1024;
+//---------------------------------------------------------------------------
+/// Draw a stratified sample of the rows, one random row from each of the equally sized strata
+static DataSource::Sample drawSample(size_t numRows, size_t numColumns) {
+    DataSource::Sample result;
+    size_t sampleSize = std::min(numRows, maxSampleSize);
+    Random rng;
+    result.rowIds.reserve(sampleSize);
+    for (size_t i = 0; i < sampleSize; i++) {
+        size_t begin = numRows * i / sampleSize, end = numRows * (i + 1) / sampleSize;
+        result.rowIds.push_back(begin + rng.nextRange(end - begin));
+    }
+    result.columns.resize(numColumns);
+    return result;
+}
+//---------------------------------------------------------------------------
+/// The bitset that selects all rows of a sample
+static Vector<uint64_t> makeSampleMask(size_t sampleSize) {
+    Vector<uint64_t> result((sampleSize + 63) / 64, ~0ull);
+    if (sampleSize % 64)
+        result.back() = ~0ull >> (64 - sampleSize % 64);
+    return result;
+}
+//---------------------------------------------------------------------------
 TableScan QueryPlan::buildScan(Input& input, BitSet requiredEqs, double mult) {
     assert(input.isBase());
     BitSet eqs = input.producedEq & requiredEqs;
@@ -116,19 +159,47 @@ TableScan QueryPlan::buildScan(Input& input, BitSet requiredEqs, double mult) {
         unsigned col = input.producedAttributes.getIndex(attr.front());
         if (auto it = eqRestrictions.find(eq); it != eqRestrictions.end()) {
             double selectivity = 1.0;
-            // Sample may not be prepared yet, we might be eliminating singletons
-            if (!input.sample.empty()) {
-                auto off = input.sampleOffsets.at(eq);
-                auto matches = it->second->run(input.sample.data() + off, ~0ull >> (64 - input.sampleSize));
-                selectivity = matches ? double(engine::popcount(matches)) / input.sampleSize : (1.0 / (input.sampleSize * 2));
+            // Sample may not be prepared yet, we might be eliminating singletons. Only integer attributes are sampled
+            if (input.sample && input.sampleColumns.find(eq) != input.sampleColumns.end()) {
+                auto matches = makeSampleMask(input.getSampleSize());
+                it->second->runWords(input.sampleColumns.at(eq), matches.data(), matches.size());
+                selectivity = input.getSampleSelectivity(matches.data(), estimateFilter(input, eq).value_or(1.0));
+            } else if (input.sample) {
+                selectivity = estimateFilter(input, eq).value_or(it->second->estimateSelectivity());
             }
             restrictions.push_back(TableScan::RestrictionInfo{col, selectivity, it->second});
         }
+        if (auto it = eqStringRestrictions.find(eq); it != eqStringRestrictions.end())
+            restrictions.push_back(TableScan::RestrictionInfo{col, it->second->estimateSelectivity(), nullptr, it->second.get()});
     }
 
     return TableScan(input.tableInfo, colsVec, restrictions, mult, double(input.cardinality) / input.tableInfo.numRows);
 }
 //---------------------------------------------------------------------------
+const ColumnStatistics* QueryPlan::getStatistics(const Input& input, unsigned eq) const {
+    if (!input.isBase())
+        return nullptr;
+    auto attr = input.producedAttributes & equivalenceSets[eq];
+    if (attr.empty())
+        return nullptr;
+    auto& statistics = input.table->columns[attributes[attr.front()].column].statistics;
+    return statistics ? &*statistics : nullptr;
+}
+//---------------------------------------------------------------------------
+std::optional<double> QueryPlan::estimateFilter(const Input& input, unsigned eq) const {
+    auto* statistics = getStatistics(input, eq);
+    if (!statistics)
+        return {};
+    if (auto it = eqFilters.find(eq); it != eqFilters.end())
+        return statistics->estimate(it->second);
+    if (auto it = eqInLists.find(eq); it != eqInLists.end()) {
+        Restriction filter{Restriction::In, RuntimeValue::from(DataType::INT32, 0)};
+        filter.values = it->second;
+        return statistics->estimate(filter);
+    }
+    return {};
+}
+//---------------------------------------------------------------------------
 void QueryPlan::estimateCardinality(Input& input) {
     if (!input.isBase()) {
         assert(input.ht);
@@ -144,6 +215,8 @@ void QueryPlan::estimateCardinality(Input& input) {
             auto& r = *eqRestrictions.at(eq);
             sels.push_back(r.estimateSelectivity());
         }
+        if (auto it = eqStringRestrictions.find(eq); it != eqStringRestrictions.end())
+            sels.push_back(it->second->estimateSelectivity());
     }
     std::sort(sels.begin(), sels.end());
 
@@ -198,7 +271,50 @@ void QueryPlan::prepare(SmallVec<BitSet> inputEqs) {
     });
 }
 //---------------------------------------------------------------------------
-void QueryPlan::setOutput(engine::span<const unsigned> attrs) {
+/// Append a value to a description
+static void appendValue(std::string& description, uint64_t value) {
+    description.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+//---------------------------------------------------------------------------
+void QueryPlan::addFilter(unsigned attr, const Restriction& restriction) {
+    assert(attr < attributes.size() && "Have you prepared query plan?");
+    if (attributes[attr].dataType == DataType::VARCHAR) {
+        // String restrictions cannot be intersected, multiple ones are evaluated one after another
+        auto logic = StringRestrictionLogic::setupRestriction(restriction);
+        auto& existing = eqStringRestrictions[attributes[attr].eqClass];
+        existing = existing ? StringRestrictionLogic::conjunction(std::move(existing), std::move(logic)) : std::move(logic);
+        auto& description = eqStringFilters[attributes[attr].eqClass];
+        appendValue(description, restriction.type);
+        appendValue(description, restriction.pattern.size());
+        description.append(restriction.pattern);
+        return;
+    }
+    assert(attributes[attr].dataType == DataType::INT32 || attributes[attr].dataType == DataType::FP64);
+    // Filters on the same equivalence class hold for all of its attributes, so ranges and lists can be intersected
+    unsigned eq = attributes[attr].eqClass;
+    if (restriction.type == Restriction::In) {
+        assert(attributes[attr].dataType == DataType::INT32);
+        assert(std::is_sorted(restriction.values.begin(), restriction.values.end()));
+        auto [it, inserted] = eqInLists.try_emplace(eq, restriction.values.begin(), restriction.values.end());
+        if (!inserted)
+            it->second.erase(std::remove_if(it->second.begin(), it->second.end(), [&](uint64_t value) { return !std::binary_search(restriction.values.begin(), restriction.values.end(), value); }), it->second.end());
+        return;
+    }
+    assert(restriction.type == Restriction::Range || restriction.type == Restriction::DoubleRange || restriction.type == Restriction::NotNull);
+    auto [it, inserted] = eqFilters.try_emplace(eq, restriction);
+    if (inserted || restriction.type == Restriction::NotNull)
+        return;
+    auto& filter = it->second;
+    if (filter.type == Restriction::NotNull) {
+        filter = restriction;
+    } else {
+        filter.cst.value = std::max(filter.cst.value, restriction.cst.value);
+        filter.upper = std::min(filter.upper, restriction.upper);
+    }
+}
+//---------------------------------------------------------------------------
+void QueryPlan::setOutput(engine::span<const unsigned> attrs, bool distinct) {
+    this->distinct = distinct;
     outputEqs.reserve(attrs.size());
     for (unsigned a : attrs) {
         assert(a < attributes.size() && "Have you prepared query plan?");
@@ -216,6 +332,8 @@ struct QueryPlan::PlanPipeline {
         unsigned probeKeyEq;
     };
     SmallVec<ProbeInfo> probes;
+    /// The estimated number of produced tuples, 0 if unknown
+    double card = 0;
 
     bool operator<(const PlanPipeline& other) const {
         return std::make_tuple(cost, probes.size()) < std::make_tuple(other.cost, other.probes.size());
@@ -227,9 +345,26 @@ struct QueryPlan::PlanPipeline {
     bool isOutput() const {
         return keyEq == ~0u;
     }
+    /// Does the other pipeline run the same scan, probes, and build?
+    bool isSame(const PlanPipeline& other) const {
+        if (rels != other.rels || keyEq != other.keyEq || scanInput != other.scanInput || probes.size() != other.probes.size())
+            return false;
+        for (size_t i = 0; i < probes.size(); i++)
+            if (probes[i].probeInput != other.probes[i].probeInput || probes[i].probeKeyEq != other.probes[i].probeKeyEq)
+                return false;
+        return true;
+    }
 };
 //---------------------------------------------------------------------------
 static constexpr unsigned crossProductEq = 63;
+/// The maximum number of scanned rows of a pipeline that runs concurrently to other pipelines
+static constexpr size_t maxConcurrentPipelineRows = 1ull << 16;
+/// The factor by which a build pipeline may exceed its estimated number of tuples before the query is optimized again
+static constexpr double reoptimizationFactor = 32.0;
+/// The number of tuples that a build pipeline may always produce without optimizing again
+static constexpr double minReoptimizationTuples = 1 << 16;
+/// The maximum number of optimizations of a query due to an estimation error
+static constexpr unsigned maxReoptimizations = 4;
 //---------------------------------------------------------------------------
 struct QueryPlan::CheapestPipelineFinder {
     struct Subtree {
@@ -237,7 +372,7 @@ struct QueryPlan::CheapestPipelineFinder {
         PlanPipeline currentPipeline;
     };
 
-    static Subtree rec(QueryGraph& qg, QueryGraph::Plan* cur) {
+    static Subtree rec(QueryGraph& qg, QueryGraph::Plan* cur, SmallVec<PlanPipeline>* candidates) {
         Subtree result;
         if (cur->isLeaf()) {
             result.currentPipeline.rels = cur->set;
@@ -245,20 +380,24 @@ struct QueryPlan::CheapestPipelineFinder {
             result.currentPipeline.cost = 0;
             return result;
         }
-        auto left = rec(qg, cur->left);
-        auto right = rec(qg, cur->right);
+        auto left = rec(qg, cur->left, candidates);
+        auto right = rec(qg, cur->right, candidates);
         result.cheapestPipeline = std::min(left.cheapestPipeline, right.cheapestPipeline);
         PlanPipeline leftPipeline;
         if (left.currentPipeline) {
             leftPipeline = left.currentPipeline;
             auto inters = (cur->left->eqs & cur->right->eqs);
             leftPipeline.keyEq = inters.empty() ? crossProductEq : inters.front();
-            leftPipeline.cost = cur->left->cost + cur->left->card * 10;
+            leftPipeline.cost = cur->left->cost + cur->left->card * CostModel::get().build;
             leftPipeline.rels = cur->left->set;
+            leftPipeline.card = cur->left->card;
         }
         // If the left is not a hash table yet, we can consider it
-        if (leftPipeline && qg.inputs[cur->left->set.front()].joinKey == ~0u)
+        if (leftPipeline && qg.inputs[cur->left->set.front()].joinKey == ~0u) {
             result.cheapestPipeline = std::min(result.cheapestPipeline, leftPipeline);
+            if (candidates)
+                candidates->push_back(leftPipeline);
+        }
         // We are only interested in pipelines that probe leaves that are hash tables
         if (leftPipeline && cur->left->set.single() && qg.inputs[cur->left->set.front()].joinKey != ~0u) {
             // We would like to make the following assumption, but cross products make it very difficult
@@ -270,8 +409,9 @@ struct QueryPlan::CheapestPipelineFinder {
         return result;
     }
 
-    static PlanPipeline findCheapestPipeline(QueryGraph& qg, QueryGraph::Plan* root) {
-        Subtree res = rec(qg, root);
+    /// Find the cheapest pipeline. Optionally collects all pipelines that build a hash table within the plan
+    static PlanPipeline findCheapestPipeline(QueryGraph& qg, QueryGraph::Plan* root, SmallVec<PlanPipeline>* candidates = nullptr) {
+        Subtree res = rec(qg, root, candidates);
         if (res.currentPipeline) {
             res.currentPipeline.cost = root->cost;
             res.cheapestPipeline = std::min(res.cheapestPipeline, res.currentPipeline);
@@ -280,6 +420,135 @@ struct QueryPlan::CheapestPipelineFinder {
     }
 };
 //---------------------------------------------------------------------------
+/// Caches the pipelines that were chosen for a query shape. Queries of the same shape only differ in their constants, they replay
+/// the cached pipelines as long as their inputs look like the inputs the pipelines were chosen for
+struct QueryPlan::PlanCache {
+    /// The maximum factor between the cached and the current cardinality of an input for replaying a pipeline
+    static constexpr double maxDeviation = 4.0;
+    /// The maximum number of cached query shapes, the cache is cleared once it is full
+    static constexpr size_t maxEntries = 1024;
+
+    /// A cached pipeline
+    struct Pipeline {
+        BitSet rels;
+        unsigned keyEq;
+        unsigned scanInput;
+        std::vector<PlanPipeline::ProbeInfo> probes;
+        double card;
+    };
+    /// The pipelines that ran together and the inputs they were chosen for
+    struct Step {
+        /// The shape of the inputs
+        uint64_t inputShape;
+        /// The cardinalities of the inputs. The estimates of the base tables and the actual sizes of the hash tables
+        std::vector<double> cardinalities;
+        /// The pipelines
+        std::vector<Pipeline> pipelines;
+        /// The estimated cardinality of the pipeline results
+        double estimate;
+    };
+
+    /// The mutex
+    std::mutex mutex;
+    /// The pipelines per query shape
+    std::unordered_map<uint64_t, std::vector<Step>> entries;
+
+    /// Get the cache
+    static PlanCache& get() {
+        static PlanCache cache;
+        return cache;
+    }
+    /// Make a step
+    static Step makeStep(uint64_t inputShape, const SmallVec<UniquePtr<Input>>& inputs, engine::span<const PlanPipeline> pipelines, double estimate) {
+        Step step{inputShape, {}, {}, estimate};
+        for (auto& input : inputs)
+            step.cardinalities.push_back(input->cardinality);
+        for (auto& pipeline : pipelines)
+            step.pipelines.push_back({pipeline.rels, pipeline.keyEq, pipeline.scanInput, {pipeline.probes.begin(), pipeline.probes.end()}, pipeline.card});
+        return step;
+    }
+
+    /// Find the cached pipelines of a step if the inputs match
+    bool lookup(uint64_t queryShape, size_t step, uint64_t inputShape, const SmallVec<UniquePtr<Input>>& inputs, SmallVec<PlanPipeline>& pipelines, double& estimate) {
+        std::unique_lock lock(mutex);
+        auto it = entries.find(queryShape);
+        if (it == entries.end() || step >= it->second.size())
+            return false;
+        auto& cached = it->second[step];
+        if (cached.inputShape != inputShape || cached.cardinalities.size() != inputs.size())
+            return false;
+        for (size_t i = 0; i < inputs.size(); i++) {
+            auto current = inputs[i]->cardinality + 1, previous = cached.cardinalities[i] + 1;
+            if (std::max(current, previous) > std::min(current, previous) * maxDeviation)
+                return false;
+        }
+        for (auto& cachedPipeline : cached.pipelines) {
+            auto& pipeline = pipelines.emplace_back();
+            pipeline.rels = cachedPipeline.rels;
+            pipeline.keyEq = cachedPipeline.keyEq;
+            pipeline.scanInput = cachedPipeline.scanInput;
+            for (auto& probe : cachedPipeline.probes)
+                pipeline.probes.push_back(probe);
+            pipeline.cost = 0;
+            pipeline.card = cachedPipeline.card;
+        }
+        estimate = cached.estimate;
+        return true;
+    }
+    /// Store the pipelines of a query shape
+    void store(uint64_t queryShape, std::vector<Step> steps) {
+        std::unique_lock lock(mutex);
+        if (entries.size() >= maxEntries && entries.find(queryShape) == entries.end())
+            entries.clear();
+        entries[queryShape] = std::move(steps);
+    }
+};
+//---------------------------------------------------------------------------
+/// Combine a value into a hash
+static void combineHash(uint64_t& hash, uint64_t value) {
+    hash = Random::mix(hash + value + Random::addConstant, Random::xorConstant);
+}
+//---------------------------------------------------------------------------
+uint64_t QueryPlan::computeQueryShape() const {
+    uint64_t hash = 0;
+    for (auto& input : inputs) {
+        combineHash(hash, std::hash<std::string_view>()(input->table->name));
+        combineHash(hash, input->table->numRows);
+        combineHash(hash, input->producedAttributes.asU64());
+    }
+    for (auto& attr : attributes) {
+        combineHash(hash, (uint64_t{attr.relation} << 32) | attr.column);
+        combineHash(hash, (uint64_t{attr.eqClass} << 32) | static_cast<uint64_t>(attr.dataType));
+    }
+    for (auto& set : equivalenceSets)
+        combineHash(hash, set.asU64());
+    // Only the kind of the filters counts, not their constants. The hash maps are unordered, so these are combined commutatively
+    uint64_t filters = 0;
+    for (auto& [eq, filter] : eqFilters)
+        filters += Random::mix((uint64_t{eq} << 32) | filter.type, Random::xorConstant);
+    for (auto& [eq, values] : eqInLists)
+        filters += Random::mix((uint64_t{eq} << 32) | Restriction::In, Random::addConstant);
+    for (auto& [eq, logic] : eqStringRestrictions)
+        filters += Random::mix(uint64_t{eq} + 1, Random::addConstant ^ Random::xorConstant);
+    combineHash(hash, filters);
+    for (unsigned eq : outputEqs)
+        combineHash(hash, eq);
+    combineHash(hash, distinct);
+    return hash;
+}
+//---------------------------------------------------------------------------
+uint64_t QueryPlan::computeInputShape() const {
+    uint64_t hash = 0;
+    for (auto& [eq, value] : eqConstants)
+        hash += Random::mix(uint64_t{eq} + 1, Random::xorConstant);
+    for (auto& input : inputs) {
+        combineHash(hash, input->producedEq.asU64());
+        combineHash(hash, (uint64_t{input->keyEq} << 1) | input->isCrossProduct);
+        combineHash(hash, input->isBase() ? input->table->numRows : ~0ull);
+    }
+    return hash;
+}
+//---------------------------------------------------------------------------
 BitSet QueryPlan::computeRequiredEq(BitSet relations) {
     BitSet producedEqs;
     BitSet requiredEqs;
@@ -411,9 +680,57 @@ static std::tuple<uint64_t, uint64_t, uint64_t> printPlanRec(Vector<std::string>
     }
 }
 //---------------------------------------------------------------------------
-bool QueryPlan::runPipeline(const PlanPipeline& pipeline, double cardinalityEstimate) {
+std::string QueryPlan::describeBuild(const Input& input, BitSet eqs, unsigned keyEq, uint64_t lateMaterialized) const {
+    auto columnOf = [&](unsigned eq) { return attributes[(input.producedAttributes & equivalenceSets[eq]).front()].column; };
+    // The table and the layout of the hash table, the key comes first
+    std::string result;
+    appendValue(result, reinterpret_cast<uintptr_t>(input.table));
+    appendValue(result, columnOf(keyEq));
+    for (unsigned eq : eqs)
+        if (eq != keyEq)
+            appendValue(result, (uint64_t{columnOf(eq)} << 1) | ((lateMaterialized >> eqs.getIndex(eq)) & 1));
+
+    // The filters, ordered by column as the equivalence classes differ between queries
+    std::vector<std::pair<unsigned, std::string>> filters;
+    for (unsigned eq : input.producedEq) {
+        // Join filters depend on the other inputs of the query
+        if (dataRestrictedEqs.contains(eq))
+            return {};
+        std::string filter;
+        if (eqRestrictions.find(eq) != eqRestrictions.end()) {
+            if (auto it = eqInLists.find(eq); it != eqInLists.end()) {
+                appendValue(filter, Restriction::In);
+                for (uint64_t value : it->second)
+                    appendValue(filter, value);
+            } else if (auto it = eqFilters.find(eq); it != eqFilters.end()) {
+                appendValue(filter, it->second.type);
+                appendValue(filter, it->second.cst.value);
+                appendValue(filter, it->second.upper);
+            } else {
+                appendValue(filter, Restriction::NotNull);
+            }
+        }
+        if (auto it = eqStringFilters.find(eq); it != eqStringFilters.end())
+            filter += it->second;
+        if (!filter.empty())
+            filters.emplace_back(columnOf(eq), std::move(filter));
+    }
+    std::sort(filters.begin(), filters.end());
+    for (auto& [column, filter] : filters) {
+        appendValue(result, column);
+        appendValue(result, filter.size());
+        result += filter;
+    }
+    return result;
+}
+//---------------------------------------------------------------------------
+bool QueryPlan::runPipeline(const PlanPipeline& pipeline, double cardinalityEstimate, FunctionRef<void(FunctionRef<void()>)> execute, bool reoptimize) {
     // Build up the pipeline
     auto& scanInput = *inputs[pipeline.scanInput];
+    // Pipelines that are executed together change the positions of the inputs
+    SmallVec<Input*> relInputs;
+    for (unsigned rel : pipeline.rels)
+        relInputs.push_back(inputs[rel].get());
 
     struct SourceInfo {
         /// Position in the pipeline of the operator containing source
@@ -454,7 +771,7 @@ bool QueryPlan::runPipeline(const PlanPipeline& pipeline, double cardinalityEsti
         Input& input = *inputs[probe.probeInput];
         assert(!input.isBase());
         assert(input.ht);
-        probeTables.push_back(input.ht.get());
+        probeTables.push_back(input.ht);
         newInput->sourceProbes.push_back(&input);
         // We restrict cross products to be left deep to ensure only one probe per pipeline
         if (input.isCrossProduct) {
@@ -489,7 +806,8 @@ bool QueryPlan::runPipeline(const PlanPipeline& pipeline, double cardinalityEsti
     SmallVec<std::pair<SourceInfo, unsigned>> outputSources;
     outputSources.reserve(requiredEqs.size() + 1);
     if (!pipeline.isOutput()) {
-        newInput->ht = makeUnique<Hashtable>();
+        newInput->htStorage = makeUnique<Hashtable>();
+        newInput->ht = newInput->htStorage.get();
         newInput->htBuild = makeUnique<HashtableBuild>(*newInput->ht, cardinalityEstimate);
         if (pipeline.keyEq == crossProductEq) {
             // The key will come from the last column of scan
@@ -525,6 +843,44 @@ bool QueryPlan::runPipeline(const PlanPipeline& pipeline, double cardinalityEsti
         outputOffsets.push_back(src.offset);
     }
 
+    // The output columns, either an output of the pipeline or a constant
+    SmallVec<std::variant<unsigned, RuntimeValue>> outputValues;
+    if (pipeline.isOutput()) {
+        for (unsigned eq : outputEqs) {
+            if (auto it = eqConstants.find(eq); it != eqConstants.end()) {
+                auto type = attributes[equivalenceSets[eq].front()].dataType;
+                outputValues.emplace_back(RuntimeValue::from(type, it->second));
+            } else {
+                auto iter = std::find_if(outputSources.begin(), outputSources.end(), [&](auto& p) { return p.second == eq; });
+                assert(iter != outputSources.end());
+                unsigned ind = iter - outputSources.begin();
+                outputValues.push_back(ind);
+            }
+        }
+
+        // Without probes and restrictions the output is just the scanned table
+        bool unrestricted = pipeline.probes.empty() && zeroColumnValue == ~0ull && !distinct;
+        for (unsigned eq : scanInput.producedEq)
+            unrestricted &= eqRestrictions.find(eq) == eqRestrictions.end() && eqStringRestrictions.find(eq) == eqStringRestrictions.end();
+        // The pages of dictionary encoded and bit packed columns are not in the output format
+        for (unsigned attr : scanInput.producedAttributes)
+            unrestricted &= attributes[attr].info.dictionary.empty() && !attributes[attr].info.bitPacked;
+        if (unrestricted) {
+            SmallVec<TableTarget::SourceColumn> sourceColumns;
+            for (auto& [src, eq] : outputSources) {
+                assert(src.op == 0);
+                auto& attr = attributes[(scanInput.producedAttributes & equivalenceSets[eq]).front()];
+                sourceColumns.push_back({attr.dataType, attr.info.pages});
+            }
+            auto result = TableTarget::passThrough(sourceColumns, scanInput.table->numRows, outputValues);
+            if (resultSink)
+                resultSink(result);
+            else
+                finalResult = std::move(result);
+            return true;
+        }
+    }
+
     double mult = 1.0;
     for (auto* ht : probeTables)
         mult *= double(ht->getNumTuples()) / ht->getNumKeysEstimate();
@@ -532,15 +888,40 @@ bool QueryPlan::runPipeline(const PlanPipeline& pipeline, double cardinalityEsti
     TableScan scan = buildScan(scanInput, scanRequiredEqs, mult);
     if (zeroColumnValue != ~0ull)
         scan.produceConstantColumn = zeroColumnValue;
+    // Strings that are only needed for the output are carried as row ids until the output resolves them.
+    // This does not pay off if the output directly consumes the scan. Row ids cannot be deduplicated, so a
+    // distinct query must not produce them in any pipeline, the hash tables of earlier pipelines included
+    bool lateScan = config::lateMaterialization && !distinct && !(pipeline.isOutput() && pipeline.probes.empty());
+    auto isLate = [&](unsigned eq) {
+        return lateScan && equivalenceSets[eq].single() && eqConstants.find(eq) == eqConstants.end() && attributes[equivalenceSets[eq].front()].dataType == DataType::VARCHAR;
+    };
+    for (unsigned eq : scanProduced)
+        if (isLate(eq))
+            scan.lateMaterialized |= 1ull << scanProduced.getIndex(eq);
     // Optional table target if this is the last pipeline
     UniquePtr<TableTarget> tableTarget;
+    UniquePtr<DistinctTarget> distinctTarget;
     TargetBase* target;
     if (pipeline.isOutput()) {
         SmallVec<DataType> types;
         for (auto& [s, eq] : outputSources)
             types.push_back(attributes[equivalenceSets[eq].front()].dataType);
-        tableTarget = makeUnique<TableTarget>(std::move(types));
-        target = tableTarget.get();
+        if (distinct) {
+            // The distinct target deduplicates into its own table target
+            distinctTarget = makeUnique<DistinctTarget>(std::move(types), cardinalityEstimate);
+            target = distinctTarget.get();
+        } else {
+            tableTarget = makeUnique<TableTarget>(std::move(types));
+            target = tableTarget.get();
+        }
+        auto* output = distinct ? &distinctTarget->output : tableTarget.get();
+        for (unsigned i = 0; i < outputSources.size(); i++) {
+            auto eq = outputSources[i].second;
+            if (isLate(eq))
+                output->lateColumns.emplace_back(i, makeUnique<LateMaterializer>(attributes[equivalenceSets[eq].front()].info));
+        }
+        if (resultSink)
+            output->setSink(resultSink, outputValues);
     } else {
         newInput->ht->pretty = scan.getTableName();
         target = newInput->htBuild.get();
@@ -573,29 +954,73 @@ bool QueryPlan::runPipeline(const PlanPipeline& pipeline, double cardinalityEsti
 
     std::string_view pipelineName{pipelineNameBuffer, offset};
 
+    // Another query of the batch may have built the same hash table from the base table already
+    std::string buildDescription;
+    Hashtable* sharedHt = nullptr;
+    if (sharedBuilds && !pipeline.isOutput() && pipeline.probes.empty() && pipeline.keyEq != crossProductEq) {
+        buildDescription = describeBuild(scanInput, scanProduced, pipeline.keyEq, scan.lateMaterialized);
+        if (!buildDescription.empty())
+            sharedHt = sharedBuilds->find(buildDescription);
+    }
+
+    // A build that produces far more tuples than estimated is suspended to optimize the query again
+    TableScan::Suspension suspension;
+    if (reoptimize && !pipeline.isOutput() && !sharedHt && pipeline.card > 0 && numReoptimizations < maxReoptimizations) {
+        newInput->htBuild->suspendLimit = static_cast<size_t>(std::max(pipeline.card * reoptimizationFactor, minReoptimizationTuples));
+        newInput->htBuild->suspendRequest = &suspension.requested;
+        scan.suspension = &suspension;
+    }
+
     PipelineFunction pipelineFunction = PipelineFunctions::lookupPipeline(pipelineName);
     // Run the pipeline
-    pipelineFunction(*target, scan, probeTables, probeOffsets, outputOffsets);
+    if (sharedHt)
+        execute([] {});
+    else
+        execute([&] { pipelineFunction(*target, scan, probeTables, probeOffsets, outputOffsets); });
 
-    if (pipeline.isOutput()) {
-        SmallVec<std::variant<unsigned, RuntimeValue>> outputValues;
-        for (unsigned eq : outputEqs) {
-            if (auto it = eqConstants.find(eq); it != eqConstants.end()) {
-                auto type = attributes[equivalenceSets[eq].front()].dataType;
-                outputValues.emplace_back(RuntimeValue::from(type, it->second));
-            } else {
-                auto iter = std::find_if(outputSources.begin(), outputSources.end(), [&](auto& p) { return p.second == eq; });
-                assert(iter != outputSources.end());
-                unsigned ind = iter - outputSources.begin();
-                outputValues.push_back(ind);
+    if (suspension.requested.load()) {
+        numReoptimizations++;
+        suspension.requested = false;
+        // Extrapolate the cardinality from the scanned morsels
+        size_t numMorsels = scan.getNumMorsels();
+        size_t scannedMorsels = std::max<size_t>(numMorsels - suspension.remainingMorsels.size(), 1);
+        observedCards[pipeline.rels.asU64()] = double(newInput->htBuild->getNumTuples()) * numMorsels / scannedMorsels;
+        if (suspension.remainingMorsels.empty()) {
+            // The scan was done already
+            newInput->htBuild->finishConsume();
+        } else {
+            double estimate;
+            if (!optimizePipeline(nullptr, estimate).isSame(pipeline)) {
+                // Abandon the pipeline, the next optimization knows its cardinality
+                return false;
             }
+            // Resume the pipeline, its collected tuples are kept
+            newInput->htBuild->suspendLimit = ~0ull;
+            suspension.resuming = true;
+            pipelineFunction(*target, scan, probeTables, probeOffsets, outputOffsets);
         }
-        assert(tableTarget);
-        finalResult = tableTarget->prepareAndExtract(outputValues);
+    }
+
+    if (pipeline.isOutput()) {
+        assert(tableTarget || distinctTarget);
+        // With a sink the result has already been passed on by the workers
+        if (!resultSink)
+            finalResult = (distinct ? distinctTarget->output : *tableTarget).prepareAndExtract(outputValues);
         return true;
     }
     assert(!pipeline.isOutput());
-    if (newInput->ht->getNumTuples() == 0) {
+    if (sharedHt) {
+        newInput->ht = sharedHt;
+    } else if (!buildDescription.empty() && !sharedBuilds->find(buildDescription)) {
+        // Pipelines of the same query that ran concurrently may have built the same hash table
+        sharedBuilds->insert(std::move(buildDescription), std::move(newInput->htStorage));
+    }
+    BitSet rels;
+    for (size_t i = 0; i < inputs.size(); i++)
+        if (std::find(relInputs.begin(), relInputs.end(), inputs[i].get()) != relInputs.end())
+            rels.insert(i);
+    // An empty hash table of a pipeline that was executed together with this one already emptied the result
+    if (rels.empty() || newInput->ht->getNumTuples() == 0) {
         inputs.clear();
         return false;
     }
@@ -606,7 +1031,7 @@ bool QueryPlan::runPipeline(const PlanPipeline& pipeline, double cardinalityEsti
     bool simplified = (requiredEqs.single() && equivalenceSets[requiredEqs.front()].size() > 1 && newInput->ht->isDuplicateFree());
     if (simplified) {
         for (size_t i = 0; i < inputs.size(); i++) {
-            if (pipeline.rels.contains(i))
+            if (rels.contains(i))
                 continue;
 
             // We currently do not want to filter existing hash tables, so we need to run the join
@@ -617,18 +1042,19 @@ bool QueryPlan::runPipeline(const PlanPipeline& pipeline, double cardinalityEsti
         }
     }
 
-    Restriction rest{simplified ? Restriction::JoinPrecise : Restriction::Join, {}, newInput->ht.get()};
+    Restriction rest{simplified ? Restriction::JoinPrecise : Restriction::Join, {}, newInput->ht};
     newInput->restrictionLogic = RestrictionLogic::setupRestriction(rest);
     assert(newInput->restrictionLogic);
     auto* newRestriction = newInput->restrictionLogic.get();
     eqRestrictions[pipeline.keyEq] = newRestriction;
+    dataRestrictedEqs.insert(pipeline.keyEq);
     newInput->cardinality = double(newInput->ht->getNumTuples());
     auto* newInputPtr = newInput.get();
 
     SmallVec<UniquePtr<Input>> newInputs;
     for (size_t i = 0; i < inputs.size(); i++) {
         // Are we removing this input?
-        if (pipeline.rels.contains(i)) {
+        if (rels.contains(i)) {
             graveyard.push_back(std::move(inputs[i]));
         } else {
             newInputs.push_back(std::move(inputs[i]));
@@ -649,6 +1075,7 @@ bool QueryPlan::runPipeline(const PlanPipeline& pipeline, double cardinalityEsti
                 Restriction rest{Restriction::Eq, RuntimeValue::from(attributes[equivalenceSets[eq].front()].dataType, value)};
                 auto& logic = newInputPtr->additionalRestrictionLogics.emplace_back(RestrictionLogic::setupRestriction(rest));
                 eqRestrictions[eq] = logic.get();
+                dataRestrictedEqs.insert(eq);
             }
             for (auto& input : newInputs) {
                 if (!input->producedEq.contains(eq))
@@ -656,7 +1083,7 @@ bool QueryPlan::runPipeline(const PlanPipeline& pipeline, double cardinalityEsti
                 // Not easy to handle the hash table case
                 if (!input->isBase())
                     continue;
-                input->sampleMatches = newRestriction->run(input->sample.data() + input->sampleOffsets.at(eq), input->sampleMatches);
+                newRestriction->runWords(input->sampleColumns.at(eq), input->sampleMatches.data(), input->sampleMatches.size());
                 input->recomputeCardinality();
             }
         }
@@ -666,17 +1093,76 @@ bool QueryPlan::runPipeline(const PlanPipeline& pipeline, double cardinalityEsti
     else
         graveyard.push_back(std::move(newInput));
     inputs = std::move(newInputs);
+    // The observed cardinalities refer to the old inputs
+    observedCards.clear();
 
     for (auto& input : inputs) {
         if (input->isBase() && input->producedEq.contains(pipeline.keyEq)) {
-            unsigned off = input->sampleOffsets.at(pipeline.keyEq);
-            input->sampleMatches = newRestriction->run(input->sample.data() + off, input->sampleMatches);
+            newRestriction->runWords(input->sampleColumns.at(pipeline.keyEq), input->sampleMatches.data(), input->sampleMatches.size());
             input->recomputeCardinality();
         }
     }
     return false;
 }
 //---------------------------------------------------------------------------
+bool QueryPlan::runPipelines(engine::span<const PlanPipeline> pipelines, double cardinalityEstimate) {
+    if (pipelines.size() == 1)
+        return runPipeline(pipelines[0], cardinalityEstimate, [](FunctionRef<void()> run) { run(); }, config::reoptimize);
+
+    // Set up each pipeline while the previous one waits for its execution. Once all are set up, they run concurrently,
+    // and they finish in reverse order
+    SmallVec<FunctionRef<void()>> runs;
+    auto prepare = [&](auto& self, size_t index) -> bool {
+        return runPipeline(pipelines[index], cardinalityEstimate, [&](FunctionRef<void()> run) {
+            runs.push_back(run);
+            if (index + 1 < pipelines.size())
+                self(self, index + 1);
+            else
+                Scheduler::parallelIndependent(0, runs.size(), [&](size_t, size_t i) { runs[i](); });
+        });
+    };
+    bool done = prepare(prepare, 0);
+    assert(!done && runs.size() == pipelines.size());
+    return done;
+}
+//---------------------------------------------------------------------------
+void QueryPlan::addIndependentPipelines(SmallVec<PlanPipeline>& pipelines, engine::span<const PlanPipeline> candidates) const {
+    auto isSmall = [&](const PlanPipeline& pipeline) {
+        if (pipeline.isOutput() || pipeline.keyEq == crossProductEq)
+            return false;
+        for (auto& probe : pipeline.probes)
+            if (inputs[probe.probeInput]->isCrossProduct)
+                return false;
+        return inputs[pipeline.scanInput]->getUnfilteredRows() <= maxConcurrentPipelineRows;
+    };
+    // Large pipelines use all workers on their own
+    assert(pipelines.size() == 1);
+    if (!isSmall(pipelines[0]))
+        return;
+
+    auto computeProducedEq = [&](const PlanPipeline& pipeline) {
+        BitSet producedEq;
+        for (unsigned rel : pipeline.rels)
+            producedEq += inputs[rel]->producedEq;
+        return producedEq;
+    };
+    // The pipelines must neither share inputs nor equivalence classes, then they do not influence each other
+    BitSet usedRels = pipelines[0].rels;
+    BitSet usedEqs = computeProducedEq(pipelines[0]);
+    for (auto& candidate : candidates) {
+        if (pipelines.size() >= Scheduler::concurrency())
+            break;
+        if (!isSmall(candidate) || !(usedRels & candidate.rels).empty())
+            continue;
+        auto producedEq = computeProducedEq(candidate);
+        if (!(usedEqs & producedEq).empty())
+            continue;
+        pipelines.push_back(candidate);
+        usedRels += candidate.rels;
+        usedEqs += producedEq;
+    }
+}
+//---------------------------------------------------------------------------
 void QueryPlan::eliminateSingletons() {
     // Eliminate empty tables
     for (size_t i = 0; i < inputs.size(); i++) {
@@ -706,6 +1192,7 @@ void QueryPlan::eliminateSingletons() {
                 Restriction rest{Restriction::Eq, RuntimeValue::from(attributes[equivalenceSets[eq].front()].dataType, val)};
                 inputs[i]->restrictionLogic = RestrictionLogic::setupRestriction(rest);
                 eqRestrictions[eq] = inputs[i]->restrictionLogic.get();
+                dataRestrictedEqs.insert(eq);
             }
         }
 
@@ -716,72 +1203,301 @@ void QueryPlan::eliminateSingletons() {
     }
 }
 //---------------------------------------------------------------------------
+bool QueryPlan::isSampled(unsigned attr) const {
+    unsigned eq = attributes[attr].eqClass;
+    // Filtered attributes are sampled as well, so their selectivity is known
+    return (attributes[attr].dataType == DataType::INT32) && ((equivalenceSets[eq].size() > 1) || (eqFilters.find(eq) != eqFilters.end()) || (eqInLists.find(eq) != eqInLists.end()));
+}
+//---------------------------------------------------------------------------
 void QueryPlan::computeSamples() {
-    // Compute samples
+    // The samples are cached in the tables. Draw the missing rows and reserve the missing columns first, so that every column is sampled once
+    // even if a table is scanned by several inputs
+    SmallVec<std::pair<DataSource::Table*, unsigned>> missingColumns;
+    for (auto& input : inputs) {
+        assert(input->isBase());
+        auto& sample = input->table->sample;
+        if (sample.rowIds.empty())
+            sample = drawSample(input->table->numRows, input->table->columns.size());
+        for (unsigned attr : input->producedAttributes) {
+            auto& values = sample.columns[attributes[attr].column];
+            if (isSampled(attr) && values.empty()) {
+                values.assign((sample.rowIds.size() + 63) / 64 * 64, static_cast<uint32_t>(RuntimeValue::nullValue));
+                missingColumns.emplace_back(input->table, attr);
+            }
+        }
+    }
+    Scheduler::parallelFor(0, missingColumns.size(), [&](size_t workerId, size_t ind) {
+        auto [table, attr] = missingColumns[ind];
+        TableScan::sampleColumn(attributes[attr].info, table->sample.rowIds, table->sample.columns[attributes[attr].column].data());
+    });
+
+    // Evaluate the restrictions on the samples
     Scheduler::parallelFor(0, inputs.size(), [&](size_t workerId, size_t inputInd) {
         auto& input = inputs[inputInd];
-        assert(input->isBase());
+        auto& sample = input->table->sample;
         BitSet intEqs;
         for (unsigned attr : input->producedAttributes) {
+            if (!isSampled(attr))
+                continue;
             unsigned eq = attributes[attr].eqClass;
-            if ((attributes[attr].dataType == DataType::INT32) && (equivalenceSets[eq].size() > 1)) {
-                intEqs.insert(eq);
-                input->sampleOffsets[eq] = 0;
-            }
-        }
-        input->sampleSize = std::min(input->table->numRows, size_t(64));
-        for (auto& [eq, off] : input->sampleOffsets) {
-            input->sampleOffsets[eq] = input->sampleSize * intEqs.getIndex(eq);
+            intEqs.insert(eq);
+            input->sampleColumns[eq] = sample.columns[attributes[attr].column].data();
         }
+        input->sample = &sample;
+        input->sampleMatches = makeSampleMask(sample.rowIds.size());
         auto scan = buildScan(*input, intEqs, 1);
-        input->sample = scan.createUnfilteredSample(input->sampleSize);
-        input->sampleMatches = (~0ull >> (64 - input->sampleSize));
-        for (auto& [eq, off] : input->sampleOffsets) {
+        scan.filterSample(sample.rowIds, input->sampleMatches.data());
+        for (auto& [eq, values] : input->sampleColumns) {
             assert(eqRestrictions.find(eq) != eqRestrictions.end());
-            auto* rest = eqRestrictions.at(eq);
-            input->sampleMatches = rest->run(input->sample.data() + off, input->sampleMatches);
+            eqRestrictions.at(eq)->runWords(values, input->sampleMatches.data(), input->sampleMatches.size());
         }
+        input->statisticsSelectivity = 1.0;
+        for (unsigned eq : input->producedEq)
+            input->statisticsSelectivity *= estimateFilter(*input, eq).value_or(1.0);
         input->recomputeCardinality();
     });
 }
 //---------------------------------------------------------------------------
+/// The maximum number of hash tables whose joins with a base table are sampled
+static constexpr size_t maxSampledHashtables = 8;
+/// The maximum number of partial join results per join step, more are subsampled
+static constexpr size_t maxJoinSampleTuples = 4096;
+/// The maximum number of hash table entries a join step may visit, the estimate is dropped otherwise
+static constexpr size_t maxJoinSampleWork = 1ull << 20;
+//---------------------------------------------------------------------------
+void QueryPlan::sampleJoins(QueryGraph& qg) {
+    // The hash tables act as indexes on their keys
+    SmallVec<unsigned> tables;
+    BitSet tableEqs;
+    for (unsigned i = 0; i < inputs.size(); i++) {
+        if (inputs[i]->isBase() || inputs[i]->isCrossProduct)
+            continue;
+        tables.push_back(i);
+        for (auto& [eq, off] : inputs[i]->eqOffsets)
+            tableEqs.insert(eq);
+    }
+    if (tables.empty() || tables.size() > maxSampledHashtables)
+        return;
+
+    /// Partial join results of sampled rows, i.e., the values of the equivalence classes of the hash tables and a weight per tuple
+    struct JoinSample {
+        /// The produced equivalence classes
+        BitSet eqs;
+        /// The values, one entry per equivalence class of the hash tables
+        Vector<uint64_t> values;
+        /// The number of results that a tuple represents
+        Vector<double> weights;
+    };
+    size_t stride = tableEqs.size();
+    Random rng;
+
+    // Probe a hash table with partial results. Joins with more results keep a uniform random subset whose weights represent all of them
+    auto probe = [&](const JoinSample& current, const Input& table, JoinSample& next) {
+        next.eqs = current.eqs;
+        for (auto& [eq, off] : table.eqOffsets)
+            next.eqs.insert(eq);
+        size_t produced = 0, work = 0;
+        unsigned keyColumn = tableEqs.getIndex(table.keyEq);
+        for (size_t row = 0; row < current.weights.size(); row++) {
+            const uint64_t* values = current.values.data() + row * stride;
+            table.ht->iterateMatches(values[keyColumn], [&](const uint64_t* tuple) {
+                work++;
+                // The hash table may close a cycle, its other classes must match as well
+                for (auto& [eq, off] : table.eqOffsets)
+                    if (current.eqs.contains(eq) && values[tableEqs.getIndex(eq)] != tuple[Hashtable::keyOffset + off])
+                        return;
+                size_t slot = produced++;
+                if (slot >= maxJoinSampleTuples) {
+                    slot = rng.nextRange(produced);
+                    if (slot >= maxJoinSampleTuples)
+                        return;
+                } else {
+                    next.values.resize(next.values.size() + stride);
+                    next.weights.push_back(0);
+                }
+                uint64_t* target = next.values.data() + slot * stride;
+                std::copy(values, values + stride, target);
+                for (auto& [eq, off] : table.eqOffsets)
+                    target[tableEqs.getIndex(eq)] = tuple[Hashtable::keyOffset + off];
+                next.weights[slot] = current.weights[row] * (config::handleMultiplicity ? tuple[0] : 1);
+            });
+            if (work > maxJoinSampleWork)
+                return false;
+        }
+        if (produced > next.weights.size())
+            for (auto& weight : next.weights)
+                weight *= double(produced) / next.weights.size();
+        return true;
+    };
+
+    for (unsigned b = 0; b < inputs.size(); b++) {
+        auto& base = *inputs[b];
+        if (!base.isBase() || !base.sample)
+            continue;
+        // The matching sampled rows are the start of the walk
+        JoinSample root;
+        for (unsigned eq : base.producedEq & tableEqs)
+            if (base.sampleColumns.find(eq) != base.sampleColumns.end())
+                root.eqs.insert(eq);
+        if (root.eqs.empty())
+            continue;
+        for (size_t row = 0; row < base.getSampleSize(); row++) {
+            if (!(base.sampleMatches[row / 64] & (1ull << (row % 64))))
+                continue;
+            root.values.resize(root.values.size() + stride);
+            for (unsigned eq : root.eqs)
+                root.values[root.values.size() - stride + tableEqs.getIndex(eq)] = base.sampleColumns.at(eq)[row];
+            root.weights.push_back(1.0);
+        }
+        double scale = double(base.table->numRows) / base.getSampleSize();
+
+        // Every set of hash tables is reached once, all orders of joining them produce the same result
+        Vector<uint8_t> visited(1ull << tables.size());
+        auto walk = [&](auto& self, const JoinSample& current, BitSet rels, uint64_t joined) -> void {
+            for (unsigned t = 0; t < tables.size(); t++) {
+                auto& table = *inputs[tables[t]];
+                uint64_t nextJoined = joined | (1ull << t);
+                if ((joined & (1ull << t)) || visited[nextJoined] || !current.eqs.contains(table.keyEq))
+                    continue;
+                visited[nextJoined] = true;
+                JoinSample next;
+                if (!probe(current, table, next))
+                    continue;
+                double sum = 0;
+                for (double weight : next.weights)
+                    sum += weight;
+                // Without any result, assume half a sampled row like the base table estimates
+                qg.sampledCards[(rels + BitSet{tables[t]}).asU64()] = sum ? sum * scale : scale / 2;
+                if (sum)
+                    self(self, next, rels + BitSet{tables[t]}, nextJoined);
+            }
+        };
+        walk(walk, root, BitSet{b}, 0);
+    }
+}
+//---------------------------------------------------------------------------
+QueryPlan::PlanPipeline QueryPlan::optimizePipeline(SmallVec<PlanPipeline>* candidates, double& estimate) {
+    SmallVec<QueryGraph::Input> qgInputs;
+    qgInputs.reserve(inputs.size());
+    BitSet constants;
+    for (auto& [k, v] : eqConstants)
+        constants.insert(k);
+    for (auto& input : inputs) {
+        assert(input->isBase() == (input->keyEq == ~0u));
+        double mult = 1.0;
+        if (!input->isBase())
+            mult = double(input->ht->getNumTuples()) / input->ht->getNumKeysEstimate();
+        SmallVec<std::pair<unsigned, double>> distinctValues;
+        for (unsigned eq : input->producedEq - constants)
+            if (auto* statistics = getStatistics(*input, eq))
+                distinctValues.emplace_back(eq, double(statistics->numDistinct));
+        qgInputs.push_back({input->producedEq - constants, input->cardinality, mult, input->keyEq, std::move(distinctValues)});
+    }
+    // The cardinalities observed by suspended pipelines beat any estimate
+    for (auto& [set, card] : observedCards)
+        if (BitSet::fromU64(set).single())
+            qgInputs[BitSet::fromU64(set).front()].cardinality = card;
+    QueryGraph qg(*this, qgInputs);
+    sampleJoins(qg);
+    for (auto& [set, card] : observedCards)
+        qg.sampledCards[set] = card;
+    QueryGraph::Plan* root = qg.optimize();
+
+    auto pipeline = CheapestPipelineFinder::findCheapestPipeline(qg, root, candidates);
+    assert(!!pipeline);
+    assert(!pipeline.rels.empty());
+    estimate = root->card;
+    return pipeline;
+}
+//---------------------------------------------------------------------------
 ColumnarTable QueryPlan::run() {
+    // The shape is computed before the filters are turned into restrictions
+    uint64_t queryShape = config::planCache ? computeQueryShape() : 0;
+    // The pushed down IN-lists, a range on the same class only removes values from the list
+    for (auto& [eq, values] : eqInLists) {
+        if (auto it = eqFilters.find(eq); it != eqFilters.end()) {
+            auto& filter = it->second;
+            if (filter.type == Restriction::Range)
+                values.erase(std::remove_if(values.begin(), values.end(), [&](uint64_t value) { return (value < filter.cst.value) || (value > filter.upper); }), values.end());
+            eqFilters.erase(it);
+        }
+        if (values.empty()) {
+            // No value is left, the result is empty
+            inputs.clear();
+            continue;
+        }
+        Restriction filter{Restriction::In, RuntimeValue::from(DataType::INT32, values.front())};
+        filter.values = values;
+        eqRestrictions[eq] = filterLogics.emplace_back(RestrictionLogic::setupRestriction(filter)).get();
+    }
+    // The pushed down filters, they imply not null as well
+    for (auto& [eq, filter] : eqFilters) {
+        if ((filter.type == Restriction::Range || filter.type == Restriction::DoubleRange) && filter.cst.value > filter.upper) {
+            // Contradicting filters, the result is empty
+            inputs.clear();
+            continue;
+        }
+        if (auto logic = RestrictionLogic::setupRestriction(filter))
+            eqRestrictions[eq] = filterLogics.emplace_back(std::move(logic)).get();
+        else
+            eqRestrictions[eq] = RestrictionLogic::notNullRestriction;
+    }
     for (unsigned eq = 0; eq < equivalenceSets.size(); eq++) {
         assert(!equivalenceSets[eq].empty());
-        if (!equivalenceSets[eq].single())
+        if (!equivalenceSets[eq].single() && eqRestrictions.find(eq) == eqRestrictions.end())
             eqRestrictions[eq] = RestrictionLogic::notNullRestriction;
     };
 
     eliminateSingletons();
     computeSamples();
 
+    // Queries of the same shape replay the pipelines that were chosen for an earlier one as long as their inputs match
+    auto& planCache = PlanCache::get();
+    std::vector<PlanCache::Step> steps;
+    bool replaying = config::planCache;
     while (!inputs.empty()) {
-        // Optimize the join plan
-        SmallVec<QueryGraph::Input> qgInputs;
-        qgInputs.reserve(inputs.size());
-        BitSet constants;
-        for (auto& [k, v] : eqConstants)
-            constants.insert(k);
-        for (auto& input : inputs) {
-            assert(input->isBase() == (input->keyEq == ~0u));
-            double mult = 1.0;
-            if (!input->isBase())
-                mult = double(input->ht->getNumTuples()) / input->ht->getNumKeysEstimate();
-            qgInputs.push_back({input->producedEq - constants, input->cardinality, mult, input->keyEq});
-        }
-        QueryGraph qg(*this, qgInputs);
-        QueryGraph::Plan* root = qg.optimize();
-
-        // Find the cheapest pipeline within the join plan
-        PlanPipeline pipeline = CheapestPipelineFinder::findCheapestPipeline(qg, root);
-        assert(!!pipeline);
-        assert(!pipeline.rels.empty());
-
-        if (runPipeline(pipeline, root->card))
+        uint64_t inputShape = computeInputShape();
+        SmallVec<PlanPipeline> pipelines;
+        double estimate;
+        replaying = replaying && planCache.lookup(queryShape, steps.size(), inputShape, inputs, pipelines, estimate);
+        if (replaying) {
+            steps.push_back(PlanCache::makeStep(inputShape, inputs, pipelines, estimate));
+            if (runPipelines(pipelines, estimate))
+                return std::move(finalResult);
+            // The inputs did not look like the cached ones after all
+            if (!observedCards.empty()) {
+                steps.pop_back();
+                replaying = false;
+            }
+            continue;
+        }
+
+        // Optimize the join plan and find the cheapest pipeline within it
+        SmallVec<PlanPipeline> candidates;
+        pipelines.push_back(optimizePipeline(&candidates, estimate));
+        // Small pipelines do not keep all workers busy, independent ones run concurrently
+        if (config::concurrentPipelines) {
+            std::sort(candidates.begin(), candidates.end());
+            addIndependentPipelines(pipelines, candidates);
+        }
+
+        if (config::planCache)
+            steps.push_back(PlanCache::makeStep(inputShape, inputs, pipelines, estimate));
+        if (runPipelines(pipelines, estimate)) {
+            if (config::planCache)
+                planCache.store(queryShape, std::move(steps));
             return std::move(finalResult);
+        }
+        // An abandoned pipeline leaves its observed cardinality for the next optimization, it is not cached
+        if (config::planCache && !observedCards.empty())
+            steps.pop_back();
     }
 
     // Empty input
+    return getEmptyResult();
+}
+//---------------------------------------------------------------------------
+ColumnarTable QueryPlan::getEmptyResult() const {
     SmallVec<DataType> outputTypes;
     for (unsigned eq : outputEqs)
         outputTypes.push_back(attributes[equivalenceSets[eq].front()].dataType);
@@ -793,4 +1509,20 @@ ColumnarTable QueryPlan::run() {
     return res;
 }
 //---------------------------------------------------------------------------
+void QueryPlan::run(ResultSink sink) {
+    // The sink always receives the output columns, an empty result is passed on as a single chunk without rows
+    std::atomic<bool> emitted = false;
+    auto forward = [&](ColumnarTable& chunk) {
+        emitted.store(true, std::memory_order_relaxed);
+        sink(chunk);
+    };
+    resultSink = forward;
+    run();
+    resultSink = {};
+    if (!emitted.load(std::memory_order_relaxed)) {
+        auto chunk = getEmptyResult();
+        sink(chunk);
+    }
+}
+//---------------------------------------------------------------------------
 }
@@ -3,9 +3,13 @@
 #include "infra/BitSet.hpp"
 #include "infra/QueryMemory.hpp"
 #include "infra/SmallVec.hpp"
+#include "infra/Util.hpp"
 #include "query/DataSource.hpp"
 #include "query/Restriction.hpp"
+#include "query/ResultSink.hpp"
 #include "query/RuntimeValue.hpp"
+#include <optional>
+#include <string>
 #include <variant>
 #include <vector>
 #include <attribute.h>
@@ -18,7 +22,10 @@ class Hashtable;
 class HashtableBuild;
 class TableScan;
 class RestrictionLogic;
+class StringRestrictionLogic;
 class QueryGraph;
+class SharedBuilds;
+struct ColumnStatistics;
 //---------------------------------------------------------------------------
 class QueryPlan {
     public:
@@ -33,12 +40,16 @@ class QueryPlan {
     /// A pipeline descriptor
     struct PlanPipeline;
     struct CheapestPipelineFinder;
+    /// The cache of the pipelines chosen for earlier queries of the same shape
+    struct PlanCache;
     /// The input data
     DataSource* db;
     /// All attributes provided by table scans in the query plan
     Vector<Attribute> attributes;
     /// The output equivalence classes
     SmallVec<unsigned> outputEqs;
+    /// Eliminate duplicates in the output?
+    bool distinct = false;
     /// The inputs
     SmallVec<UniquePtr<Input>> inputs;
     /// The used inputs that we have to keep alive
@@ -49,23 +60,66 @@ class QueryPlan {
     UnorderedMap<unsigned, uint64_t> eqConstants;
     /// Equivalence classes for which we have a restriction
     UnorderedMap<unsigned, const RestrictionLogic*> eqRestrictions;
+    /// Filters pushed down into the scans, per equivalence class
+    UnorderedMap<unsigned, Restriction> eqFilters;
+    /// IN-lists pushed down into the scans, per equivalence class. The sorted values
+    UnorderedMap<unsigned, Vector<uint64_t>> eqInLists;
+    /// The restriction logics of the filters
+    SmallVec<UniquePtr<RestrictionLogic>> filterLogics;
+    /// Filters on strings pushed down into the scans, per equivalence class
+    UnorderedMap<unsigned, UniquePtr<StringRestrictionLogic>> eqStringRestrictions;
+    /// The descriptions of the string filters, per equivalence class
+    UnorderedMap<unsigned, std::string> eqStringFilters;
+    /// Equivalence classes whose restrictions depend on the data of other inputs, e.g., join filters
+    BitSet dataRestrictedEqs;
+    /// The hash tables shared with the other queries of a batch, if any
+    SharedBuilds* sharedBuilds = nullptr;
+    /// The cardinalities of relation sets observed by suspended pipelines, keyed by the set. Valid until the inputs change
+    UnorderedMap<uint64_t, double> observedCards;
+    /// The number of optimizations due to estimation errors
+    unsigned numReoptimizations = 0;
     /// The result
     ColumnarTable finalResult;
+    /// The optional sink for streaming the result
+    ResultSink resultSink;
 
     /// Estimate the cardinality of a table and the selectivities of its restrictions
     void estimateCardinality(Input& input);
+    /// The statistics of the column of an equivalence class in a base table, nullptr if unknown
+    const ColumnStatistics* getStatistics(const Input& input, unsigned eq) const;
+    /// Estimate the selectivity of the pushed down filter on an equivalence class from the column statistics
+    std::optional<double> estimateFilter(const Input& input, unsigned eq) const;
     /// Build a table scan for an input
     TableScan buildScan(Input& input, BitSet requiredEqs, double mult);
     /// Compute the required equivalence classes outside of a set of relations
     BitSet computeRequiredEq(BitSet relations);
     /// Eliminate singletons
     void eliminateSingletons();
+    /// Is the attribute sampled? Only 32 bit integer attributes that are joined or filtered are
+    bool isSampled(unsigned attr) const;
     /// Compute samples
     void computeSamples();
-    /// Run a pipeline
-    bool runPipeline(const PlanPipeline& pipeline, double cardinalityEstimate);
+    /// Estimate the joins of the base tables with the existing hash tables by walking their samples through the hash tables
+    void sampleJoins(QueryGraph& qg);
+    /// Compute the shape of the query for the plan cache, i.e., everything except the constants
+    uint64_t computeQueryShape() const;
+    /// Compute the shape of the current inputs for the plan cache
+    uint64_t computeInputShape() const;
+    /// Describe a hash table that is built directly from a base table for sharing it within a batch. Empty if it cannot be shared
+    std::string describeBuild(const Input& input, BitSet eqs, unsigned keyEq, uint64_t lateMaterialized) const;
+    /// Optimize the join order of the current inputs and find the cheapest pipeline. Optionally collects the candidate build pipelines
+    PlanPipeline optimizePipeline(SmallVec<PlanPipeline>* candidates, double& estimate);
+    /// Run a pipeline. The set up pipeline is passed to the executor, which runs it. With reoptimize, a build that produces far more
+    /// tuples than estimated is suspended, and it is abandoned if the query is optimized differently with the observed cardinality
+    bool runPipeline(const PlanPipeline& pipeline, double cardinalityEstimate, FunctionRef<void(FunctionRef<void()>)> execute, bool reoptimize = false);
+    /// Run independent pipelines concurrently
+    bool runPipelines(engine::span<const PlanPipeline> pipelines, double cardinalityEstimate);
+    /// Add the small candidate pipelines that are independent of the cheapest pipeline to run them concurrently
+    void addIndependentPipelines(SmallVec<PlanPipeline>& pipelines, engine::span<const PlanPipeline> candidates) const;
     /// Print a query plan
     void printPlan(Input& root) const;
+    /// Build the result of a query without rows
+    ColumnarTable getEmptyResult() const;
 
     public:
     /// Constructor
@@ -83,11 +137,17 @@ class QueryPlan {
     void addAttribute(unsigned relation, unsigned column, DataType dataType);
     /// Prepare query plan after all inputs and attributes have been added
     void prepare(SmallVec<BitSet> equivalenceSets);
-    /// Set the output attribtues
-    void setOutput(engine::span<const unsigned> attrs);
+    /// Add a filter on an attribute after preparing. Supports Range and NotNull restrictions on integers and the string restrictions on strings
+    void addFilter(unsigned attr, const Restriction& restriction);
+    /// Set the output attribtues, optionally eliminating duplicate rows
+    void setOutput(engine::span<const unsigned> attrs, bool distinct = false);
+    /// Share the hash tables that are built directly from base tables with the other queries of a batch
+    void setSharedBuilds(SharedBuilds* builds) { sharedBuilds = builds; }
 
     /// Run the query
     ColumnarTable run();
+    /// Run the query and pass the result to the sink in chunks
+    void run(ResultSink sink);
 };
 //---------------------------------------------------------------------------
 }
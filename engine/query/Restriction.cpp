@@ -1,18 +1,60 @@
 #include "query/Restriction.hpp"
 #include "op/Hashtable.hpp"
+#include "storage/StringPtr.hpp"
+#include "storage/StringRestrictionLogic.hpp"
+#include <algorithm>
+#include <limits>
 //---------------------------------------------------------------------------
 namespace engine {
 //---------------------------------------------------------------------------
 bool Restriction::operator()(uint64_t val) const noexcept {
+    // Strings are compared by value
+    auto stringEquals = [&] { return StringPtr(val).materialize_string() == pattern; };
+    auto stringLike = [&] { return StringRestrictionLogic::like(StringPtr(val).materialize_string(), pattern); };
+    auto stringIn = [&] {
+        auto str = StringPtr(val).materialize_string();
+        for (size_t pos = 0; pos <= pattern.size();) {
+            auto end = std::min(pattern.find('\n', pos), pattern.size());
+            if (pattern.substr(pos, end - pos) == str)
+                return true;
+            pos = end + 1;
+        }
+        return false;
+    };
     switch (type) {
         case Eq:
             assert(cst.value != nullValue);
             return val == cst.value;
+        case In: return (val != nullValue) && std::binary_search(values.begin(), values.end(), val);
+        case Range: return (val != nullValue) && (cst.value <= val) && (val <= upper);
+        case DoubleRange: return (val != nullValue) && (cst.value <= doubleKey(val)) && (doubleKey(val) <= upper);
+        case StringEq: return (val != nullValue) && stringEquals();
+        case StringIn: return (val != nullValue) && stringIn();
+        case Like: return (val != nullValue) && stringLike();
         case NotNull: return val != nullValue;
+        case StringNeq: return (val != nullValue) && !stringEquals();
+        case NotLike: return (val != nullValue) && !stringLike();
         case Join: return (val != nullValue) && joinFilter->joinFilter(val);
         case JoinPrecise: return (val != nullValue) && joinFilter->joinFilterPrecise(val);
     }
     __builtin_unreachable();
 }
 //---------------------------------------------------------------------------
+std::optional<Restriction> Restriction::int32Range(int64_t lower, int64_t upper) {
+    lower = std::max<int64_t>(lower, std::numeric_limits<int32_t>::min());
+    upper = std::min<int64_t>(upper, std::numeric_limits<int32_t>::max());
+    Restriction result{Range, RuntimeValue::from(DataType::INT32, static_cast<uint32_t>(lower))};
+    result.upper = static_cast<uint32_t>(upper);
+    if (lower > upper) {
+        // Nothing matches
+        result.cst.value = 1;
+        result.upper = 0;
+    } else if (lower == std::numeric_limits<int32_t>::min() && upper == std::numeric_limits<int32_t>::max()) {
+        result.type = NotNull;
+    } else if (lower < 0 && upper >= 0) {
+        return std::nullopt;
+    }
+    return result;
+}
+//---------------------------------------------------------------------------
 }
\ No newline at end of file
@@ -1,6 +1,10 @@
 #pragma once
 //---------------------------------------------------------------------------
+#include "infra/helper/BitOps.hpp"
+#include "infra/helper/Span.hpp"
 #include "query/RuntimeValue.hpp"
+#include <optional>
+#include <string_view>
 //---------------------------------------------------------------------------
 namespace engine {
 //---------------------------------------------------------------------------
@@ -14,8 +18,24 @@ struct Restriction {
     enum Type {
         /// Attribute is equal to value
         Eq,
+        /// Attribute is equal to one of the values, compared as unsigned 32 bit values
+        In,
+        /// Attribute lies within [cst, upper], compared as unsigned 32 bit values
+        Range,
+        /// FP64 attribute lies within [cst, upper], the bounds are keys, see doubleKey
+        DoubleRange,
+        /// String attribute is equal to pattern
+        StringEq,
+        /// String attribute is equal to one of the newline separated strings of pattern
+        StringIn,
+        /// String attribute matches the LIKE pattern
+        Like,
         /// Attribute is not null
         NotNull,
+        /// String attribute is not equal to pattern
+        StringNeq,
+        /// String attribute does not match the LIKE pattern
+        NotLike,
         /// Attribute will likely find a join partner
         Join,
         /// Attribute will definitely find a join partner
@@ -29,9 +49,36 @@ struct Restriction {
     Hashtable* joinFilter;
     /// The selectivity estimation for the restriction
     double selectivity = 1.0;
+    /// The inclusive upper bound of a range
+    uint64_t upper = 0;
+    /// The string compared with. Restriction logics copy it, so it only has to outlive their setup
+    std::string_view pattern;
+    /// The sorted values of an In restriction. Restriction logics copy them, so they only have to outlive their setup
+    engine::span<const uint64_t> values;
 
     /// Check whether the restriction is satisfied by a value
     bool operator()(uint64_t val) const noexcept;
+
+    /// The restriction for INT32 values within [lower, upper], as the scan compares them, i.e., unsigned. An empty range results in a Range with cst > upper,
+    /// a range covering the whole domain in NotNull. Returns nothing if the range contains negative and non-negative values, which are not contiguous then
+    static std::optional<Restriction> int32Range(int64_t lower, int64_t upper);
+
+    /// Map the bits of a double to an unsigned key with the same order. -0.0 and 0.0 share a key and NaN is larger than all other values, like in SQL
+    static constexpr uint64_t doubleKey(uint64_t bits) noexcept {
+        constexpr uint64_t signBit = 1ull << 63;
+        if ((bits & ~signBit) > 0x7ff0000000000000ull)
+            return ~0ull;
+        if (bits == signBit)
+            bits = 0;
+        return (bits & signBit) ? ~bits : (bits | signBit);
+    }
+    /// Map a double to its key
+    static uint64_t doubleKey(double value) noexcept { return doubleKey(engine::bit_cast<uint64_t>(value)); }
+    /// Map a key back to the bits of a double. Keys between +inf and NaN map to NaNs, keys below -inf to negative NaNs
+    static constexpr uint64_t fromDoubleKey(uint64_t key) noexcept {
+        constexpr uint64_t signBit = 1ull << 63;
+        return (key & signBit) ? (key & ~signBit) : ~key;
+    }
 };
 //---------------------------------------------------------------------------
 }
\ No newline at end of file
@@ -0,0 +1,12 @@
+#pragma once
+//---------------------------------------------------------------------------
+#include "infra/Util.hpp"
+#include <plan.h>
+//---------------------------------------------------------------------------
+namespace engine {
+//---------------------------------------------------------------------------
+/// Receives chunks of the result while the output pipeline is running. May be called concurrently
+using ResultSink = FunctionRef<void(ColumnarTable& chunk)>;
+//---------------------------------------------------------------------------
+}
+//---------------------------------------------------------------------------
@@ -0,0 +1,20 @@
+#include "query/SharedBuilds.hpp"
+#include "op/Hashtable.hpp"
+#include <cassert>
+//---------------------------------------------------------------------------
+namespace engine {
+//---------------------------------------------------------------------------
+SharedBuilds::SharedBuilds() = default;
+SharedBuilds::~SharedBuilds() = default;
+//---------------------------------------------------------------------------
+Hashtable* SharedBuilds::find(const std::string& description) const {
+    auto it = hashtables.find(description);
+    return (it != hashtables.end()) ? it->second.get() : nullptr;
+}
+//---------------------------------------------------------------------------
+void SharedBuilds::insert(std::string description, UniquePtr<Hashtable> ht) {
+    assert(hashtables.find(description) == hashtables.end());
+    hashtables.emplace(std::move(description), std::move(ht));
+}
+//---------------------------------------------------------------------------
+}
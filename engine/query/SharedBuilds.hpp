@@ -0,0 +1,29 @@
+#pragma once
+//---------------------------------------------------------------------------
+#include "infra/QueryMemory.hpp"
+#include <string>
+#include <unordered_map>
+//---------------------------------------------------------------------------
+namespace engine {
+//---------------------------------------------------------------------------
+class Hashtable;
+//---------------------------------------------------------------------------
+/// The hash tables that the queries of a batch built directly from a base table. A query that builds a hash table from the same
+/// columns with the same filters on the same key uses the existing one instead. Must live within the query memory of the batch
+class SharedBuilds {
+    /// The hash tables by the description of their build
+    std::unordered_map<std::string, UniquePtr<Hashtable>> hashtables;
+
+    public:
+    /// Constructor
+    SharedBuilds();
+    /// Destructor
+    ~SharedBuilds();
+
+    /// Find a hash table, nullptr if no query built it yet
+    Hashtable* find(const std::string& description) const;
+    /// Take over a hash table that a query built, there must be none with the same description yet
+    void insert(std::string description, UniquePtr<Hashtable> ht);
+};
+//---------------------------------------------------------------------------
+}
@@ -0,0 +1,162 @@
+#include "storage/BitPacking.hpp"
+#include "infra/Util.hpp"
+#include "infra/helper/BitOps.hpp"
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstring>
+#if defined(__x86_64__) && defined(__AVX2__)
+#include <immintrin.h>
+#endif
+//---------------------------------------------------------------------------
+namespace engine {
+//---------------------------------------------------------------------------
+#if defined(__x86_64__) && defined(__AVX2__)
+/// The widths that the vectorized kernel supports, every value must fit into the 32 bit lane with its bit offset
+static constexpr unsigned maxVectorWidth = 25;
+//---------------------------------------------------------------------------
+/// Moves the bytes of 8 packed values into the 32 bit lanes and aligns the values
+struct UnpackPattern {
+    /// The byte shuffle, the upper 4 lanes shuffle a second load that starts at the fourth value
+    alignas(32) std::array<uint8_t, 32> shuffle;
+    /// The shifts of the lanes
+    alignas(32) std::array<uint32_t, 8> shift;
+};
+//---------------------------------------------------------------------------
+static constexpr auto unpackPatterns = []() {
+    std::array<UnpackPattern, maxVectorWidth + 1> result{};
+    for (unsigned width = 1; width <= maxVectorWidth; width++) {
+        unsigned upperStart = 4 * width / 8;
+        for (unsigned lane = 0; lane < 8; lane++) {
+            unsigned bit = lane * width;
+            unsigned byte = bit / 8 - (lane < 4 ? 0 : upperStart);
+            for (unsigned i = 0; i < 4; i++)
+                result[width].shuffle[lane * 4 + i] = byte + i;
+            result[width].shift[lane] = bit % 8;
+        }
+    }
+    return result;
+}();
+#endif
+//---------------------------------------------------------------------------
+unsigned BitPacking::computeWidth(uint32_t min, uint32_t max) noexcept {
+    assert(min <= max);
+    return engine::bit_width(max - min);
+}
+//---------------------------------------------------------------------------
+void BitPacking::pack(uint8_t* dst, const uint32_t* src, unsigned width, uint32_t base, size_t count) noexcept {
+    // The target is zeroed, so or-ing whole words only sets the bits of the value. This touches up to 7 bytes after the last value
+    for (size_t i = 0; i < count; i++) {
+        assert(src[i] >= base && engine::bit_width(src[i] - base) <= static_cast<int>(width));
+        size_t bit = i * width;
+        auto* word = dst + bit / 8;
+        unalignedStore(word, unalignedLoad<uint64_t>(word) | (static_cast<uint64_t>(src[i] - base) << (bit % 8)));
+    }
+}
+//---------------------------------------------------------------------------
+void BitPacking::unpack(uint32_t* dst, const uint8_t* src, unsigned width, uint32_t base, size_t count) noexcept {
+    auto* end = dst + (count + 7) / 8 * 8;
+    if (width == 0) {
+        std::fill(dst, end, base);
+        return;
+    }
+#if defined(__x86_64__) && defined(__AVX2__)
+    // 8 values occupy exactly width bytes. Load the bytes of the lower and upper 4 values into the two halves, shuffle each value into its lane and shift it into place
+    if (width <= maxVectorWidth) {
+        auto& pattern = unpackPatterns[width];
+        __m256i shuffle = _mm256_load_si256(reinterpret_cast<const __m256i*>(pattern.shuffle.data()));
+        __m256i shift = _mm256_load_si256(reinterpret_cast<const __m256i*>(pattern.shift.data()));
+        __m256i mask = _mm256_set1_epi32(static_cast<int>((1u << width) - 1));
+        __m256i baseVec = _mm256_set1_epi32(static_cast<int>(base));
+        unsigned upperStart = 4 * width / 8;
+        for (; dst != end; dst += 8, src += width) {
+            __m256i bytes = _mm256_set_m128i(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + upperStart)), _mm_loadu_si128(reinterpret_cast<const __m128i*>(src)));
+            __m256i values = _mm256_srlv_epi32(_mm256_shuffle_epi8(bytes, shuffle), shift);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), _mm256_add_epi32(_mm256_and_si256(values, mask), baseVec));
+        }
+        return;
+    }
+#endif
+    uint64_t mask = (1ull << width) - 1;
+    for (size_t bit = 0; dst != end; dst++, bit += width)
+        *dst = base + static_cast<uint32_t>((unalignedLoad<uint64_t>(src + bit / 8) >> (bit % 8)) & mask);
+}
+//---------------------------------------------------------------------------
+const uint32_t* BitPacking::Decoder::get(const DataSource::Page* page, size_t begin, size_t count) noexcept {
+    if (page != this->page) {
+        this->page = page;
+        memset(decoded, 0, sizeof(decoded));
+    }
+    assert(page->numNotNull <= maxValues);
+    auto* blocks = getBlocks(*page);
+    size_t numBlocks = (page->numNotNull + blockSize - 1) / blockSize;
+    for (size_t block = begin / blockSize, end = std::min((begin + count + blockSize - 1) / blockSize, numBlocks); block < end; block++) {
+        auto& bits = decoded[block / 64];
+        if (bits & (1ull << (block % 64)))
+            continue;
+        bits |= 1ull << (block % 64);
+        auto& header = blocks[block];
+        unpack(values + block * blockSize, reinterpret_cast<const uint8_t*>(page->data) + header.offset, header.width, header.base, std::min(blockSize, page->numNotNull - block * blockSize));
+    }
+    return values + begin;
+}
+//---------------------------------------------------------------------------
+bool BitPacking::PageWriter::add(std::optional<uint32_t> value) {
+    // The blocks start at the 8 byte aligned data, see DataSource::Page::getData
+    static constexpr size_t blocksStart = 4;
+    size_t inBlock = values.size() % blockSize;
+    uint32_t min = blockMin, max = blockMax;
+    if (value) {
+        if (values.size() == maxValues)
+            return false;
+        min = inBlock ? std::min(min, *value) : *value;
+        max = inBlock ? std::max(max, *value) : *value;
+        inBlock++;
+    }
+    size_t size = blocksStart + completeSize + padding + (numRows + 8) / 8;
+    if (inBlock)
+        size += sizeof(BlockHeader) + packedSize(computeWidth(min, max), inBlock);
+    if (numRows == maxRows || size > sizeof(DataSource::Page::data))
+        return false;
+
+    if (numRows % 8 == 0)
+        notNulls.push_back(0);
+    if (value) {
+        notNulls.back() |= 1 << (numRows % 8);
+        values.push_back(*value);
+        blockMin = min;
+        blockMax = max;
+        if (inBlock == blockSize)
+            completeSize += sizeof(BlockHeader) + packedSize(computeWidth(min, max), blockSize);
+    }
+    numRows++;
+    return true;
+}
+//---------------------------------------------------------------------------
+void BitPacking::PageWriter::write(DataSource::Page& page) {
+    page = {};
+    page.numRows = numRows;
+    page.numNotNull = values.size();
+    auto* blocks = page.getData<BlockHeader>();
+    size_t numBlocks = (values.size() + blockSize - 1) / blockSize;
+    size_t offset = reinterpret_cast<std::byte*>(blocks + numBlocks) - page.data;
+    for (size_t block = 0; block < numBlocks; block++) {
+        auto* begin = values.data() + block * blockSize;
+        auto count = std::min(blockSize, values.size() - block * blockSize);
+        auto [min, max] = std::minmax_element(begin, begin + count);
+        unsigned width = computeWidth(*min, *max);
+        blocks[block] = BlockHeader{*min, static_cast<uint16_t>(offset), static_cast<uint8_t>(width)};
+        pack(reinterpret_cast<uint8_t*>(page.data) + offset, begin, width, *min, count);
+        offset += packedSize(width, count);
+    }
+    assert(offset + padding <= static_cast<size_t>(reinterpret_cast<std::byte*>(page.getNulls()) - page.data));
+    memcpy(page.getNulls(), notNulls.data(), notNulls.size());
+
+    values.clear();
+    notNulls.clear();
+    numRows = 0;
+    completeSize = 0;
+}
+//---------------------------------------------------------------------------
+}
+//---------------------------------------------------------------------------
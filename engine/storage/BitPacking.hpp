@@ -0,0 +1,86 @@
+#pragma once
+//---------------------------------------------------------------------------
+#include "query/DataSource.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+//---------------------------------------------------------------------------
+namespace engine {
+//---------------------------------------------------------------------------
+/// Frame of reference compression with bit packing for pages of 32 bit values, i.e., INT32 values or dictionary codes.
+/// The non-null values of a page are split into blocks of 64 values. Every block stores its minimum and the differences to it with the
+/// smallest sufficient bit width. The block headers start at the 8 byte aligned data, the packed blocks follow them and the null bitmap stays at the end of the page
+class BitPacking {
+    public:
+    /// The number of values per block
+    static constexpr size_t blockSize = 64;
+    /// The maximum number of non-null values of a page
+    static constexpr size_t maxValues = 8192;
+    /// The maximum number of rows of a page
+    static constexpr size_t maxRows = 0xfff0;
+    /// The space after the last block, the unpack kernels may read up to that far beyond it
+    static constexpr size_t padding = 16;
+
+    /// The header of a block
+    struct BlockHeader {
+        /// The minimum of the block
+        uint32_t base;
+        /// The offset of the packed values from the start of the page data
+        uint16_t offset;
+        /// The number of bits per value
+        uint8_t width;
+        uint8_t unused = 0;
+    };
+    static_assert(sizeof(BlockHeader) == 8);
+
+    /// Decodes the blocks of bit packed pages on demand
+    class Decoder {
+        /// The page whose blocks are in values
+        const DataSource::Page* page = nullptr;
+        /// The blocks of the page that were decoded already
+        uint64_t decoded[maxValues / blockSize / 64];
+        /// The decoded values
+        uint32_t values[maxValues];
+
+        public:
+        /// Get the non-null values [begin, begin + count) of a page. Only decodes the blocks that were not decoded yet
+        const uint32_t* get(const DataSource::Page* page, size_t begin, size_t count) noexcept;
+    };
+
+    /// Collects the values of a bit packed page
+    class PageWriter {
+        /// The non-null values
+        std::vector<uint32_t> values;
+        /// The null bitmap
+        std::vector<uint8_t> notNulls;
+        /// The number of rows
+        size_t numRows = 0;
+        /// The size of the headers and the packed values of the complete blocks
+        size_t completeSize = 0;
+        /// The range of the current block
+        uint32_t blockMin = 0, blockMax = 0;
+
+        public:
+        /// Add a value, nullopt is null. Returns false if the page is full
+        bool add(std::optional<uint32_t> value);
+        /// Is the page empty?
+        bool empty() const { return numRows == 0; }
+        /// Write the page and start a new one
+        void write(DataSource::Page& page);
+    };
+
+    /// Get the block headers of a page
+    static const BlockHeader* getBlocks(const DataSource::Page& page) { return page.getData<BlockHeader>(); }
+    /// The number of bits needed for the differences to the minimum
+    static unsigned computeWidth(uint32_t min, uint32_t max) noexcept;
+    /// The number of bytes of count packed values, count is padded to groups of 8 values
+    static constexpr size_t packedSize(unsigned width, size_t count) { return (count + 7) / 8 * width; }
+    /// Pack count values as differences to base
+    static void pack(uint8_t* dst, const uint32_t* src, unsigned width, uint32_t base, size_t count) noexcept;
+    /// Unpack count values and add base. Always writes whole groups of 8 values
+    static void unpack(uint32_t* dst, const uint8_t* src, unsigned width, uint32_t base, size_t count) noexcept;
+};
+//---------------------------------------------------------------------------
+}
+//---------------------------------------------------------------------------
@@ -0,0 +1,115 @@
+#include "storage/ColumnStatistics.hpp"
+#include "infra/helper/BitOps.hpp"
+#include "query/Restriction.hpp"
+#include <algorithm>
+#include <cmath>
+//---------------------------------------------------------------------------
+namespace engine {
+//---------------------------------------------------------------------------
+void ColumnStatistics::Builder::add(uint64_t key, uint64_t keyHash) {
+    auto& reg = registers[keyHash >> (64 - registerBits)];
+    uint8_t rank = std::min<unsigned>(engine::countl_zero(keyHash << registerBits), 64 - registerBits) + 1;
+    reg = std::max(reg, rank);
+
+    // Reservoir sampling keeps every value with the same probability
+    uint64_t numValues = numRows - numNulls;
+    if (sample.size() < sampleSize) {
+        sample.push_back(key);
+    } else if (auto slot = rng.nextRange(numValues + 1); slot < sampleSize) {
+        sample[slot] = key;
+    }
+    numRows++;
+}
+//---------------------------------------------------------------------------
+ColumnStatistics ColumnStatistics::Builder::finish() {
+    ColumnStatistics result{};
+    result.numRows = numRows;
+    result.numNulls = numNulls;
+    uint64_t numValues = numRows - numNulls;
+    if (!numValues)
+        return result;
+
+    // The HyperLogLog estimate, small counts use linear counting on the empty registers
+    constexpr double m = 1ull << registerBits;
+    double sum = 0;
+    size_t empty = 0;
+    for (auto reg : registers) {
+        sum += std::ldexp(1.0, -reg);
+        empty += !reg;
+    }
+    double estimate = (0.7213 / (1 + 1.079 / m)) * m * m / sum;
+    if (estimate <= 2.5 * m && empty)
+        estimate = m * std::log(m / empty);
+    result.numDistinct = std::clamp<uint64_t>(std::llround(estimate), 1, numValues);
+
+    std::sort(sample.begin(), sample.end());
+    double scale = double(numValues) / sample.size();
+    // The heavy hitters are the keys that fill more than a bucket of the histogram, their sampled frequency is reliable
+    std::vector<std::pair<size_t, uint64_t>> runs;
+    for (size_t begin = 0, end; begin < sample.size(); begin = end) {
+        for (end = begin + 1; end < sample.size() && sample[end] == sample[begin]; end++);
+        if ((end - begin) * numBuckets > sample.size())
+            runs.emplace_back(end - begin, sample[begin]);
+    }
+    std::sort(runs.begin(), runs.end(), [](auto& a, auto& b) { return a.first > b.first; });
+    for (size_t i = 0; i < std::min(runs.size(), numHeavyHitters); i++) {
+        result.heavyHitters[i] = runs[i].second;
+        result.heavyHitterCounts[i] = std::llround(runs[i].first * scale);
+    }
+    for (size_t i = 0; i <= numBuckets; i++)
+        result.bounds[i] = sample[(sample.size() - 1) * i / numBuckets];
+    return result;
+}
+//---------------------------------------------------------------------------
+double ColumnStatistics::estimateEq(uint64_t key) const {
+    if (!getNumValues())
+        return 0.0;
+    uint64_t heavyCount = 0, numHeavy = 0;
+    for (size_t i = 0; i < numHeavyHitters && heavyHitterCounts[i]; i++) {
+        if (heavyHitters[i] == key)
+            return double(heavyHitterCounts[i]) / numRows;
+        heavyCount += heavyHitterCounts[i];
+        numHeavy++;
+    }
+    if (key < bounds[0] || key > bounds[numBuckets])
+        return 0.0;
+    // The other keys share the remaining values evenly
+    double remaining = double(getNumValues() - std::min(heavyCount, getNumValues()));
+    return remaining / std::max<uint64_t>(numDistinct - std::min(numHeavy, numDistinct), 1) / numRows;
+}
+//---------------------------------------------------------------------------
+double ColumnStatistics::estimateRange(uint64_t lower, uint64_t upper) const {
+    if (!getNumValues() || lower > upper)
+        return 0.0;
+    // The keys are assumed to be uniformly distributed within a bucket
+    double fraction = 0;
+    for (size_t i = 0; i < numBuckets; i++) {
+        uint64_t begin = bounds[i], end = bounds[i + 1];
+        if (upper < begin || lower > end)
+            continue;
+        long double overlap = static_cast<long double>(std::min(upper, end) - std::max(lower, begin)) + 1;
+        fraction += static_cast<double>(overlap / (static_cast<long double>(end - begin) + 1)) / numBuckets;
+    }
+    return fraction * getNumValues() / numRows;
+}
+//---------------------------------------------------------------------------
+std::optional<double> ColumnStatistics::estimate(const Restriction& restriction) const {
+    if (!isKnown())
+        return {};
+    switch (restriction.type) {
+        case Restriction::Eq: return estimateEq(restriction.cst.value);
+        case Restriction::In: {
+            double result = 0;
+            for (auto value : restriction.values)
+                result += estimateEq(value);
+            return std::min(result, 1.0 - getNullFraction());
+        }
+        case Restriction::Range:
+        case Restriction::DoubleRange: return estimateRange(restriction.cst.value, restriction.upper);
+        case Restriction::NotNull: return 1.0 - getNullFraction();
+        default: return {};
+    }
+}
+//---------------------------------------------------------------------------
+}
+//---------------------------------------------------------------------------
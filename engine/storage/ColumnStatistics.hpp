@@ -0,0 +1,94 @@
+#pragma once
+//---------------------------------------------------------------------------
+#include "infra/Random.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <type_traits>
+#include <vector>
+//---------------------------------------------------------------------------
+namespace engine {
+//---------------------------------------------------------------------------
+struct Restriction;
+//---------------------------------------------------------------------------
+/// The statistics of a column, computed when the database is serialized and stored in the header of the file.
+/// They describe the keys of the values: INT32 values, dictionary codes and INT64 values compare unsigned, FP64 values by their
+/// Restriction::doubleKey and strings by their DataSource::ZoneMap::stringKey. Unknown statistics have no rows
+struct ColumnStatistics {
+    /// The number of heavy hitters
+    static constexpr size_t numHeavyHitters = 8;
+    /// The number of buckets of the histogram
+    static constexpr size_t numBuckets = 64;
+
+    /// The number of rows
+    uint64_t numRows;
+    /// The number of nulls
+    uint64_t numNulls;
+    /// The estimated number of distinct non-null values
+    uint64_t numDistinct;
+    /// The most frequent keys, the most frequent first
+    uint64_t heavyHitters[numHeavyHitters];
+    /// The estimated number of occurrences of the heavy hitters, 0 for unused entries
+    uint64_t heavyHitterCounts[numHeavyHitters];
+    /// The bounds of the equi-depth histogram. Every bucket [bounds[i], bounds[i + 1]] holds the same number of non-null values
+    uint64_t bounds[numBuckets + 1];
+
+    /// Collects the keys of a column in a single pass. The distinct count is estimated with a HyperLogLog sketch of all keys,
+    /// the heavy hitters and the histogram are derived from a reservoir sample
+    class Builder {
+        /// The number of bits of the hash that select a register
+        static constexpr unsigned registerBits = 11;
+        /// The size of the sample
+        static constexpr size_t sampleSize = 1ull << 14;
+
+        /// The registers of the sketch, i.e., the maximum rank per register
+        std::array<uint8_t, 1ull << registerBits> registers{};
+        /// The sample
+        std::vector<uint64_t> sample;
+        /// The random generator for the sample
+        Random rng;
+        /// The number of rows and nulls
+        uint64_t numRows = 0, numNulls = 0;
+
+        public:
+        /// Hash a key, the sketch needs all bits to be well mixed. The finalizer of MurmurHash3
+        static constexpr uint64_t hash(uint64_t key) {
+            key ^= key >> 33;
+            key *= 0xff51afd7ed558ccdull;
+            key ^= key >> 33;
+            key *= 0xc4ceb9fe1a85ec53ull;
+            return key ^ (key >> 33);
+        }
+        /// Add a null
+        void addNull() {
+            numRows++;
+            numNulls++;
+        }
+        /// Add a key with the hash of its value. Strings hash their whole value, as different strings can share a key
+        void add(uint64_t key, uint64_t keyHash);
+        /// Add a key that identifies the value
+        void add(uint64_t key) { add(key, hash(key)); }
+        /// Compute the statistics
+        ColumnStatistics finish();
+    };
+
+    /// Are the statistics known?
+    bool isKnown() const { return numRows != 0; }
+    /// The number of non-null values
+    uint64_t getNumValues() const { return numRows - numNulls; }
+    /// The fraction of values that are null
+    double getNullFraction() const { return isKnown() ? double(numNulls) / numRows : 0.0; }
+    /// Estimate the fraction of the rows whose key equals key
+    double estimateEq(uint64_t key) const;
+    /// Estimate the fraction of the rows whose key lies within [lower, upper]
+    double estimateRange(uint64_t lower, uint64_t upper) const;
+    /// Estimate the selectivity of a restriction on the column. Only numeric restrictions are supported
+    std::optional<double> estimate(const Restriction& restriction) const;
+};
+//---------------------------------------------------------------------------
+static_assert(sizeof(ColumnStatistics) % sizeof(uint64_t) == 0);
+static_assert(std::is_trivially_copyable_v<ColumnStatistics> && std::is_trivially_default_constructible_v<ColumnStatistics>, "The statistics are copied from and to the file header");
+//---------------------------------------------------------------------------
+}
+//---------------------------------------------------------------------------
@@ -95,6 +95,10 @@ void CopyLogic::extractInt64(uint64_t* dst, const uint64_t* src, uint64_t srcOff
     return extractor(dst, src, srcOffsets, dstOffsets, numTuples, [](const auto* value) { return *value; });
 }
 //---------------------------------------------------------------------------
+void CopyLogic::extractDictionary(uint64_t* dst, const uint32_t* src, uint64_t srcOffsets, uint64_t dstOffsets, size_t numTuples, const uint64_t* dictionary) noexcept {
+    return extractor(dst, src, srcOffsets, dstOffsets, numTuples, [dictionary](const auto* value) { return dictionary[*value]; });
+}
+//---------------------------------------------------------------------------
 void CopyLogic::extractVarChar(uint64_t* dst, const uint16_t* src, uint64_t srcOffsets, uint64_t dstOffsets, size_t numTuples, const char* stringHead) noexcept {
     return extractor(dst, src, srcOffsets, dstOffsets, numTuples, [stringHead](const auto* value) {
         auto offset = *value;
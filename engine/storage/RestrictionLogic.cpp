@@ -1,8 +1,13 @@
 #include "storage/RestrictionLogic.hpp"
 #include "infra/SmallVec.hpp"
+#include "infra/helper/BitOps.hpp"
 #include "op/Hashtable.hpp"
 #include "query/Restriction.hpp"
 #include "storage/BitLogic.hpp"
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <string>
 #if defined(__x86_64__)
 #include <immintrin.h>
 #endif
@@ -141,6 +146,7 @@ struct EQRestriction : public RestrictionBuilder<EQRestriction> {
         auto cmp = v == broadcast(target);
         return movemask(cmp);
     }
+    bool mayMatch(uint64_t min, uint64_t max) const final { return (min <= target) && (target <= max); }
 
     double estimateSelectivity() const final { return 0.01; }
     double estimateCost() const final { return 1; }
@@ -174,11 +180,51 @@ struct EQ2Restriction : public RestrictionBuilder<EQ2Restriction> {
         auto cmp = cmp0 || cmp1;
         return movemask(cmp);
     }
+    bool mayMatch(uint64_t min, uint64_t max) const final {
+        return ((min <= target[0]) && (target[0] <= max)) || ((min <= target[1]) && (target[1] <= max));
+    }
 
     double estimateSelectivity() const { return 0.02; }
     double estimateCost() const final { return 1; }
 };
 //---------------------------------------------------------------------------
+/// Compares every value with a few targets, a vector of values at a time
+struct EQNRestriction : public RestrictionBuilder<EQNRestriction> {
+    /// The maximum number of targets
+    static constexpr size_t maxTargets = 8;
+    /// The sorted targets
+    std::array<uint32_t, maxTargets> target{};
+    /// The number of targets
+    unsigned count;
+
+    explicit EQNRestriction(engine::span<const uint32_t> keys) : count(keys.size()) {
+        assert(count <= maxTargets);
+        std::copy(keys.begin(), keys.end(), target.begin());
+    }
+
+    [[gnu::always_inline]] inline bool check(uint32_t v) const {
+        bool result = false;
+        for (unsigned i = 0; i < count; i++)
+            result |= target[i] == v;
+        return result;
+    }
+    static constexpr size_t vectorSize = vector_elements;
+    [[gnu::always_inline]] inline uint64_t computeMask(const uint32_t* vs) const {
+        auto v = load_unaligned(vs);
+        auto cmp = v == broadcast(target[0]);
+        for (unsigned i = 1; i < count; i++)
+            cmp = cmp || (v == broadcast(target[i]));
+        return movemask(cmp);
+    }
+    bool mayMatch(uint64_t min, uint64_t max) const final {
+        auto it = std::lower_bound(target.begin(), target.begin() + count, min);
+        return (it != target.begin() + count) && (*it <= max);
+    }
+
+    double estimateSelectivity() const final { return 0.01 * count; }
+    double estimateCost() const final { return 1; }
+};
+//---------------------------------------------------------------------------
 struct GtRestriction : public RestrictionBuilder<GtRestriction> {
     uint32_t target;
 
@@ -193,6 +239,7 @@ struct GtRestriction : public RestrictionBuilder<GtRestriction> {
         auto cmp = v > broadcast(target);
         return movemask(cmp);
     }
+    bool mayMatch(uint64_t min, uint64_t max) const final { return max > target; }
 
     double estimateSelectivity() const final { return double(std::numeric_limits<uint32_t>::max() - target) / std::numeric_limits<uint32_t>::max(); }
     double estimateCost() const final { return 1; }
@@ -212,6 +259,7 @@ struct LtRestriction : public RestrictionBuilder<LtRestriction> {
         auto cmp = v < broadcast(target);
         return movemask(cmp);
     }
+    bool mayMatch(uint64_t min, uint64_t max) const final { return min < target; }
 
     double estimateSelectivity() const final { return double(target) / std::numeric_limits<uint32_t>::max(); }
     double estimateCost() const final { return 1; }
@@ -235,6 +283,7 @@ struct BetweenRestriction : public RestrictionBuilder<BetweenRestriction> {
         auto cmp = cmp0 && cmp1;
         return movemask(cmp);
     }
+    bool mayMatch(uint64_t min, uint64_t max) const final { return (max > target[0]) && (std::max<uint64_t>(min, target[0] + 1ull) < target[1]); }
 
     double estimateSelectivity() const final { return double(target[1] - target[0]) / std::numeric_limits<uint32_t>::max(); }
     double estimateCost() const final { return 1; }
@@ -250,6 +299,8 @@ struct JoinFilterRestriction : public RestrictionBuilder<JoinFilterRestriction>
 
     explicit JoinFilterRestriction(const Hashtable* hashtable) : hashtable(hashtable) {}
 
+    bool mayMatch(uint64_t min, uint64_t max) const final { return (min <= hashtable->maxKey) && (hashtable->minKey <= max); }
+
     [[gnu::always_inline]] inline bool check(uint32_t v) const {
         return hashtable->joinFilter(v);
     }
@@ -308,11 +359,158 @@ struct JoinFilterPreciseRestriction : public RestrictionBuilder<JoinFilterPrecis
 
     explicit JoinFilterPreciseRestriction(const Hashtable* hashtable) : hashtable(hashtable) {}
 
+    bool mayMatch(uint64_t min, uint64_t max) const final { return (min <= hashtable->maxKey) && (hashtable->minKey <= max); }
+
     [[gnu::always_inline]] inline bool check(uint32_t v) const {
         return hashtable->joinFilterPrecise(v);
     }
 };
 //---------------------------------------------------------------------------
+/// Checks the values against a bitmap of the matching values between the smallest and the largest one.
+/// Used for the codes of dictionary encoded columns and for IN-lists within a small range
+struct BitmapRestriction : public RestrictionBuilder<BitmapRestriction> {
+    /// The bitmap of the matching values, relative to first
+    Vector<uint64_t> bits;
+    /// The smallest and largest matching value
+    uint32_t first, last;
+    /// The estimated selectivity
+    double selectivity;
+
+    double estimateSelectivity() const final { return selectivity; }
+    double estimateCost() const final { return 1.5; }
+
+    BitmapRestriction(engine::span<const uint32_t> values, double selectivity) : bits((values.back() - values.front()) / 64 + 1), first(values.front()), last(values.back()), selectivity(selectivity) {
+        for (auto value : values)
+            bits[(value - first) / 64] |= 1ull << ((value - first) % 64);
+    }
+
+    [[gnu::always_inline]] inline bool check(uint32_t v) const {
+        uint32_t offset = v - first;
+        return (offset <= last - first) && ((bits[offset / 64] >> (offset % 64)) & 1);
+    }
+    bool mayMatch(uint64_t min, uint64_t max) const final { return (min <= last) && (first <= max); }
+};
+//---------------------------------------------------------------------------
+/// Looks the values up in an open addressing hash table, used for large IN-lists with a wide range of values
+struct HashSetRestriction : public RestrictionBuilder<HashSetRestriction> {
+    /// The slots, either a value of the set or empty
+    Vector<uint32_t> slots;
+    /// A value that is not in the set and marks empty slots
+    uint32_t empty = 0;
+    /// The shift of the hash to the slot index
+    unsigned shift;
+    /// The smallest and largest value
+    uint32_t first, last;
+    /// The estimated selectivity
+    double selectivity;
+
+    double estimateSelectivity() const final { return selectivity; }
+    double estimateCost() const final { return 2; }
+
+    HashSetRestriction(engine::span<const uint32_t> values, double selectivity) : first(values.front()), last(values.back()), selectivity(selectivity) {
+        assert(std::is_sorted(values.begin(), values.end()));
+        // The smallest value that is not in the set
+        for (auto value : values) {
+            if (value != empty)
+                break;
+            empty++;
+        }
+        // At most half of the slots are used
+        unsigned bits = engine::bit_width(values.size()) + 1;
+        shift = 64 - bits;
+        slots.resize(size_t(1) << bits, empty);
+        for (auto value : values) {
+            size_t slot = hash(value);
+            for (; slots[slot] != empty; slot = (slot + 1) & (slots.size() - 1));
+            slots[slot] = value;
+        }
+    }
+
+    /// The home slot of a value
+    [[gnu::always_inline]] inline size_t hash(uint32_t v) const { return (v * 11400714819323198485llu) >> shift; }
+
+    [[gnu::always_inline]] inline bool check(uint32_t v) const {
+        if ((v < first) | (v > last))
+            return false;
+        // Check for the empty marker first, so that it does not match itself
+        for (size_t slot = hash(v);; slot = (slot + 1) & (slots.size() - 1)) {
+            if (slots[slot] == empty)
+                return false;
+            if (slots[slot] == v)
+                return true;
+        }
+    }
+    bool mayMatch(uint64_t min, uint64_t max) const final { return (min <= last) && (first <= max); }
+};
+//---------------------------------------------------------------------------
+/// Checks FP64 values against a range. The bounds are the keys of Restriction::doubleKey, so -0.0 equals 0.0 and NaN is larger than all other values
+struct DoubleRangeRestriction final : public RestrictionLogic {
+    /// The bounds as doubles, an empty numeric range has lower > upper
+    double lower, upper;
+    /// Does NaN match?
+    bool matchNaN;
+    /// Is the range a single value?
+    bool point;
+
+    DoubleRangeRestriction(uint64_t lowerKey, uint64_t upperKey) : matchNaN(upperKey == ~0ull), point(lowerKey == upperKey) {
+        // The keys of -inf and inf, computed from their IEEE 754 bit patterns
+        constexpr uint64_t minKey = Restriction::doubleKey(uint64_t{0xfff0000000000000});
+        constexpr uint64_t maxKey = Restriction::doubleKey(uint64_t{0x7ff0000000000000});
+        if (lowerKey > maxKey || upperKey < minKey) {
+            lower = std::numeric_limits<double>::infinity();
+            upper = -lower;
+            return;
+        }
+        lower = engine::bit_cast<double>(Restriction::fromDoubleKey(std::max(lowerKey, minKey)));
+        upper = engine::bit_cast<double>(Restriction::fromDoubleKey(std::min(upperKey, maxKey)));
+        // The key of -0.0 lies below the one of 0.0, but the comparisons treat both the same
+        if (upper == 0 && std::signbit(upper))
+            upper = -std::numeric_limits<double>::denorm_min();
+    }
+
+    [[gnu::always_inline]] inline bool check(uint64_t bits) const {
+        double v = engine::bit_cast<double>(bits);
+        return ((lower <= v) & (v <= upper)) | (matchNaN & std::isnan(v));
+    }
+
+    uint64_t runSparse64(const uint64_t* values, uint64_t mask) const final {
+        uint64_t newMask = 0;
+        for (; mask; mask &= mask - 1) {
+            auto offset = engine::countr_zero(mask);
+            newMask |= static_cast<uint64_t>(check(values[offset])) << offset;
+        }
+        return newMask;
+    }
+    uint64_t runDense64(const uint64_t* values, size_t len) const final {
+        assert(len <= 64);
+        uint64_t newMask = 0;
+        size_t i = 0;
+#if defined(__x86_64__) && defined(__AVX__)
+        __m256d lowerVec = _mm256_set1_pd(lower), upperVec = _mm256_set1_pd(upper);
+        for (; i + 4 <= len; i += 4) {
+            __m256d v = _mm256_loadu_pd(reinterpret_cast<const double*>(values + i));
+            // Ordered comparisons are false for NaN
+            __m256d cmp = _mm256_and_pd(_mm256_cmp_pd(v, lowerVec, _CMP_GE_OQ), _mm256_cmp_pd(v, upperVec, _CMP_LE_OQ));
+            if (matchNaN)
+                cmp = _mm256_or_pd(cmp, _mm256_cmp_pd(v, v, _CMP_UNORD_Q));
+            newMask |= static_cast<uint64_t>(_mm256_movemask_pd(cmp)) << i;
+        }
+#endif
+        for (; i < len; i++)
+            newMask |= static_cast<uint64_t>(check(values[i])) << i;
+        return newMask;
+    }
+
+    uint64_t runSparse(const uint32_t* values, uint64_t mask) const final { throw std::runtime_error("FP64 restrictions need 64 bit values"); }
+    uint64_t runDense(const uint32_t* values, size_t len) const final { throw std::runtime_error("FP64 restrictions need 64 bit values"); }
+    std::pair<uint64_t, size_t> runAndSkip(const uint32_t* values, size_t len) const final { throw std::runtime_error("FP64 restrictions need 64 bit values"); }
+
+    double estimateSelectivity() const final { return point ? 0.01 : 0.3; }
+    double estimateCost() const final { return 1; }
+
+    std::string_view name() const final { return ClassInfo::getName<DoubleRangeRestriction>(); }
+};
+//---------------------------------------------------------------------------
 template <size_t N, typename Hash>
 struct TinyTable : public RestrictionBuilder<TinyTable<N, Hash>>, Hash {
     std::array<uint32_t, N> values{};
@@ -350,7 +548,7 @@ constexpr std::array<uint32_t, N> makeInvalidValues() {
 }
 //---------------------------------------------------------------------------
 template <size_t N, typename Hash>
-UniquePtr<TinyTable<N, Hash>> makeTinyTable(SmallVec<uint32_t, 32>& vals, Hash hasher) {
+UniquePtr<TinyTable<N, Hash>> makeTinyTable(engine::span<const uint32_t> vals, Hash hasher) {
     // Try to make tiny lookup table. May fail!
     auto result = makeUnique<TinyTable<N, Hash>>(hasher);
     // Try to set each value to something invalid
@@ -394,9 +592,96 @@ struct Fibo2 {
     }
 };
 //---------------------------------------------------------------------------
+uint64_t RestrictionLogic::runSparse64(const uint64_t* /*values*/, uint64_t /*mask*/) const {
+    throw std::runtime_error(std::string(name()) + " does not support 64 bit values");
+}
+//---------------------------------------------------------------------------
+uint64_t RestrictionLogic::runDense64(const uint64_t* /*values*/, size_t /*len*/) const {
+    throw std::runtime_error(std::string(name()) + " does not support 64 bit values");
+}
+//---------------------------------------------------------------------------
+/// Setup the restriction logic for a small set of sorted keys, i.e., compare with all of them or find a perfect hash function. Returns null if the set is too large
+static UniquePtr<RestrictionLogic> setupKeySet(engine::span<const uint32_t> keys) {
+    assert(std::is_sorted(keys.begin(), keys.end()));
+    if (keys.empty())
+        return {};
+    switch (keys.size()) {
+        case 1: return makeUnique<EQRestriction>(keys[0]);
+        case 2: return makeUnique<EQ2Restriction>(keys[0], keys[1]);
+    }
+
+    if (keys.back() - keys.front() == keys.size() - 1) {
+        if (keys.front() == 0)
+            return makeUnique<LtRestriction>(keys.back() + 1);
+        if (keys.back() == ~0u)
+            return makeUnique<GtRestriction>(keys.front() - 1);
+        return makeUnique<BetweenRestriction>(keys.front() - 1, keys.back() + 1);
+    }
+
+    if (keys.size() <= EQNRestriction::maxTargets)
+        return makeUnique<EQNRestriction>(keys);
+
+    if (keys.size() <= 16) {
+        if (auto res = makeTinyTable<8>(keys, Identity<8>{}))
+            return res;
+        if (auto res = makeTinyTable<16>(keys, Identity<16>{}))
+            return res;
+        if (auto res = makeTinyTable<32>(keys, Identity<32>{}))
+            return res;
+        if (auto res = makeTinyTable<16>(keys, Fibo<4>{}))
+            return res;
+        if (auto res = makeTinyTable<32>(keys, Fibo<5>{}))
+            return res;
+        if (auto res = makeTinyTable<16>(keys, Fibo2<4>{}))
+            return res;
+        if (auto res = makeTinyTable<32>(keys, Fibo2<5>{}))
+            return res;
+    }
+    return {};
+}
+//---------------------------------------------------------------------------
 UniquePtr<RestrictionLogic> RestrictionLogic::setupRestriction(const Restriction& restriction) {
     if (restriction.type == Restriction::Type::Eq) {
         return makeUnique<EQRestriction>(restriction.cst.value);
+    } else if (restriction.type == Restriction::Type::Range) {
+        uint32_t lower = restriction.cst.value;
+        uint32_t upper = restriction.upper;
+        assert(restriction.cst.value <= restriction.upper);
+        assert(restriction.upper <= std::numeric_limits<uint32_t>::max());
+        if (lower == upper)
+            return makeUnique<EQRestriction>(lower);
+        // An unbounded range only excludes nulls
+        if (lower == 0 && upper == ~0u)
+            return {};
+        if (lower == 0)
+            return makeUnique<LtRestriction>(upper + 1);
+        if (upper == ~0u)
+            return makeUnique<GtRestriction>(lower - 1);
+        return makeUnique<BetweenRestriction>(lower - 1, upper + 1);
+    } else if (restriction.type == Restriction::Type::DoubleRange) {
+        assert(restriction.cst.value <= restriction.upper);
+        // An unbounded range only excludes nulls
+        if (restriction.cst.value <= Restriction::doubleKey(-std::numeric_limits<double>::infinity()) && restriction.upper == ~0ull)
+            return {};
+        return makeUnique<DoubleRangeRestriction>(restriction.cst.value, restriction.upper);
+    } else if (restriction.type == Restriction::Type::In) {
+        SmallVec<uint32_t> keys;
+        keys.reserve(restriction.values.size());
+        for (auto value : restriction.values) {
+            assert(value <= std::numeric_limits<uint32_t>::max());
+            keys.push_back(value);
+        }
+        std::sort(keys.begin(), keys.end());
+        keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+        assert(!keys.empty());
+        if (auto res = setupKeySet(keys))
+            return res;
+        double selectivity = std::min(0.01 * keys.size(), 0.9);
+        // A bitmap of at most 32KB or with at least one value per 64 bits, a hash table otherwise
+        uint64_t range = uint64_t(keys.back()) - keys.front() + 1;
+        if ((range <= (1u << 18)) || (range <= keys.size() * 64))
+            return makeUnique<BitmapRestriction>(keys, selectivity);
+        return makeUnique<HashSetRestriction>(keys, selectivity);
     } else if ((restriction.type == Restriction::Type::Join) || (restriction.type == Restriction::Type::JoinPrecise)) {
         if (restriction.joinFilter->getNumTuples() <= 32) {
             // Collect the keys
@@ -407,36 +692,8 @@ UniquePtr<RestrictionLogic> RestrictionLogic::setupRestriction(const Restriction
             });
             std::sort(keys.begin(), keys.end());
             keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
-
-            switch (keys.size()) {
-                case 1: return makeUnique<EQRestriction>(keys[0]);
-                case 2: return makeUnique<EQ2Restriction>(keys[0], keys[1]);
-            }
-
-            if (keys.back() - keys.front() == keys.size() - 1) {
-                if (keys.front() == 0)
-                    return makeUnique<LtRestriction>(keys.back() + 1);
-                if (keys.back() == ~0u)
-                    return makeUnique<GtRestriction>(keys.front() - 1);
-                return makeUnique<BetweenRestriction>(keys.front() - 1, keys.back() + 1);
-            }
-
-            if (keys.size() <= 16) {
-                if (auto res = makeTinyTable<8>(keys, Identity<8>{}))
-                    return res;
-                if (auto res = makeTinyTable<16>(keys, Identity<16>{}))
-                    return res;
-                if (auto res = makeTinyTable<32>(keys, Identity<32>{}))
-                    return res;
-                if (auto res = makeTinyTable<16>(keys, Fibo<4>{}))
-                    return res;
-                if (auto res = makeTinyTable<32>(keys, Fibo<5>{}))
-                    return res;
-                if (auto res = makeTinyTable<16>(keys, Fibo2<4>{}))
-                    return res;
-                if (auto res = makeTinyTable<32>(keys, Fibo2<5>{}))
-                    return res;
-            }
+            if (auto res = setupKeySet(keys))
+                return res;
         }
         if (restriction.type == Restriction::Type::JoinPrecise)
             return makeUnique<JoinFilterPreciseRestriction>(restriction.joinFilter);
@@ -446,5 +703,24 @@ UniquePtr<RestrictionLogic> RestrictionLogic::setupRestriction(const Restriction
     return {};
 }
 //---------------------------------------------------------------------------
+UniquePtr<RestrictionLogic> RestrictionLogic::setupCodeSet(engine::span<const uint32_t> codes, uint32_t numCodes) {
+    assert(std::is_sorted(codes.begin(), codes.end()));
+    assert(numCodes < ~0u);
+    // No code matches ~0u
+    if (codes.empty())
+        return makeUnique<EQRestriction>(~0u);
+    switch (codes.size()) {
+        case 1: return makeUnique<EQRestriction>(codes[0]);
+        case 2: return makeUnique<EQ2Restriction>(codes[0], codes[1]);
+    }
+    // Sorted dictionaries turn prefixes into ranges of codes
+    if (codes.back() - codes.front() == codes.size() - 1) {
+        if (codes.front() == 0)
+            return makeUnique<LtRestriction>(codes.back() + 1);
+        return makeUnique<BetweenRestriction>(codes.front() - 1, codes.back() + 1);
+    }
+    return makeUnique<BitmapRestriction>(codes, double(codes.size()) / numCodes);
+}
+//---------------------------------------------------------------------------
 }
 //---------------------------------------------------------------------------
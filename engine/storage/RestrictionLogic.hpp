@@ -1,6 +1,7 @@
 #pragma once
 //---------------------------------------------------------------------------
 #include "infra/QueryMemory.hpp"
+#include "infra/helper/Span.hpp"
 #include "storage/BitLogic.hpp"
 #include <cstddef>
 #include <cstdint>
@@ -26,12 +27,35 @@ class RestrictionLogic {
             return runSparse(values, mask);
         }
     }
+    /// Filter masked 64 bit values and return a bitset mask
+    uint64_t run(const uint64_t* values, uint64_t mask) const {
+        if (!mask)
+            return 0;
+        if (BitLogic::isDense(mask)) [[likely]] {
+            auto [st, en] = BitLogic::getRange(mask);
+            auto len = en - st;
+            auto result = runDense64(values + st, len);
+            return result << st;
+        } else {
+            return runSparse64(values, mask);
+        }
+    }
+    /// Filter the masked values of a multi word bitset, one word per 64 values. The values must be padded to a multiple of 64
+    void runWords(const uint32_t* values, uint64_t* masks, size_t words) const {
+        for (size_t i = 0; i < words; i++)
+            masks[i] = run(values + i * 64, masks[i]);
+    }
     virtual uint64_t runSparse(const uint32_t* values, uint64_t mask) const = 0;
     virtual uint64_t runDense(const uint32_t* values, size_t len) const = 0;
     virtual std::pair<uint64_t, size_t> runAndSkip(const uint32_t* values, size_t len) const = 0;
+    /// The kernels for 64 bit values, only restrictions on INT64 and FP64 columns implement them
+    virtual uint64_t runSparse64(const uint64_t* values, uint64_t mask) const;
+    virtual uint64_t runDense64(const uint64_t* values, size_t len) const;
     /// Estimate the selectivity very broadly
     virtual double estimateSelectivity() const = 0;
     virtual double estimateCost() const = 0;
+    /// Could any value in [min, max] pass? Used to skip pages by their zone map
+    virtual bool mayMatch(uint64_t min, uint64_t max) const { return true; }
     /// Destructor
     virtual ~RestrictionLogic() noexcept = default;
 
@@ -40,6 +64,8 @@ class RestrictionLogic {
 
     /// Setup a restriction logic given restriction
     static UniquePtr<RestrictionLogic> setupRestriction(const Restriction& restriction);
+    /// Setup a restriction logic that accepts the sorted codes of a dictionary with numCodes entries
+    static UniquePtr<RestrictionLogic> setupCodeSet(engine::span<const uint32_t> codes, uint32_t numCodes);
 
     virtual std::string_view name() const = 0;
 };
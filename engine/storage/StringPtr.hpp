@@ -105,7 +105,7 @@ struct StringPtr {
     bool operator==(StringPtr other) const {
         if (is_long() != other.is_long()) return false;
         if (!is_long())
-            return std::string_view{str(), length()} == std::string_view{other.str(), length()};
+            return std::string_view{str(), length()} == std::string_view{other.str(), other.length()};
         // two long strings
         if (num_pages() != other.num_pages()) return false;
         const auto pages_lhs = pages();
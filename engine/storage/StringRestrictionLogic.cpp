@@ -0,0 +1,384 @@
+#include "storage/StringRestrictionLogic.hpp"
+#include "infra/Reflection.hpp"
+#include "infra/helper/BitOps.hpp"
+#include "query/Restriction.hpp"
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <vector>
+#if defined(__x86_64__)
+#include <immintrin.h>
+#endif
+//---------------------------------------------------------------------------
+namespace engine {
+//---------------------------------------------------------------------------
+/// The byte length of an UTF-8 character given its first byte
+static size_t charLength(unsigned char c) {
+    return c < 0xc0 ? 1 : (c < 0xe0 ? 2 : (c < 0xf0 ? 3 : 4));
+}
+//---------------------------------------------------------------------------
+/// Wildcards never match newlines
+static bool hasNewline(const char* str, size_t len) {
+    return memchr(str, '\n', len);
+}
+//---------------------------------------------------------------------------
+/// Find the first occurrence of needle that lies completely within [begin, end). Returns end if there is none
+static const char* findSubstring(const char* begin, const char* end, std::string_view needle) {
+    size_t len = needle.size();
+    assert(len > 0);
+    if (static_cast<size_t>(end - begin) < len)
+        return end;
+    if (len == 1) {
+        auto* result = memchr(begin, needle[0], end - begin);
+        return result ? static_cast<const char*>(result) : end;
+    }
+    // Compare the first and the last character of the needle for a whole block of positions, then verify the candidates
+#if defined(__x86_64__) && defined(__AVX2__)
+    const __m256i first = _mm256_set1_epi8(needle.front());
+    const __m256i last = _mm256_set1_epi8(needle.back());
+    for (; begin + len - 1 + 32 <= end; begin += 32) {
+        __m256i blockFirst = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(begin));
+        __m256i blockLast = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(begin + len - 1));
+        uint32_t candidates = _mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(first, blockFirst), _mm256_cmpeq_epi8(last, blockLast)));
+        for (; candidates; candidates &= candidates - 1) {
+            auto pos = engine::countr_zero(candidates);
+            if (memcmp(begin + pos + 1, needle.data() + 1, len - 2) == 0)
+                return begin + pos;
+        }
+    }
+#elif defined(__x86_64__)
+    const __m128i first = _mm_set1_epi8(needle.front());
+    const __m128i last = _mm_set1_epi8(needle.back());
+    for (; begin + len - 1 + 16 <= end; begin += 16) {
+        __m128i blockFirst = _mm_loadu_si128(reinterpret_cast<const __m128i*>(begin));
+        __m128i blockLast = _mm_loadu_si128(reinterpret_cast<const __m128i*>(begin + len - 1));
+        uint32_t candidates = _mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(first, blockFirst), _mm_cmpeq_epi8(last, blockLast)));
+        for (; candidates; candidates &= candidates - 1) {
+            auto pos = engine::countr_zero(candidates);
+            if (memcmp(begin + pos + 1, needle.data() + 1, len - 2) == 0)
+                return begin + pos;
+        }
+    }
+#endif
+    auto pos = std::string_view(begin, end - begin).find(needle);
+    return pos == std::string_view::npos ? end : begin + pos;
+}
+//---------------------------------------------------------------------------
+bool StringRestrictionLogic::like(std::string_view str, std::string_view pattern) {
+    assert(pattern.find('\n') == std::string_view::npos);
+    if (hasNewline(str.data(), str.size()))
+        return false;
+    // Greedy matching that backtracks to the last '%'
+    size_t s = 0, p = 0;
+    size_t starPattern = std::string_view::npos, starString = 0;
+    while (s < str.size()) {
+        if (p < pattern.size() && pattern[p] == '%') {
+            starPattern = ++p;
+            starString = s;
+        } else if (p < pattern.size() && pattern[p] == '_') {
+            s = std::min(s + charLength(str[s]), str.size());
+            p++;
+        } else if (p < pattern.size() && pattern[p] == str[s]) {
+            s++;
+            p++;
+        } else if (starPattern != std::string_view::npos) {
+            starString = std::min(starString + charLength(str[starString]), str.size());
+            s = starString;
+            p = starPattern;
+        } else {
+            return false;
+        }
+    }
+    while (p < pattern.size() && pattern[p] == '%')
+        p++;
+    return p == pattern.size();
+}
+//---------------------------------------------------------------------------
+template <typename T, bool Negate>
+struct StringRestrictionBuilder : public StringRestrictionLogic {
+    /// Default: Check every masked string on its own
+    uint64_t runImpl(const char* strings, const uint16_t* offsets, size_t index, uint64_t mask) const {
+        uint64_t matches = 0;
+        for (; mask; mask &= mask - 1) {
+            auto bit = engine::countr_zero(mask);
+            size_t i = index + bit;
+            size_t begin = i ? offsets[i - 1] : 0;
+            matches |= static_cast<uint64_t>(static_cast<const T&>(*this).matches(strings + begin, offsets[i] - begin)) << bit;
+        }
+        return matches;
+    }
+    uint64_t run(const char* strings, const uint16_t* offsets, size_t index, uint64_t mask) const final {
+        if (!mask)
+            return 0;
+        uint64_t matches = static_cast<const T&>(*this).runImpl(strings, offsets, index, mask);
+        return Negate ? (mask & ~matches) : matches;
+    }
+    bool check(std::string_view str) const final {
+        return static_cast<const T&>(*this).matches(str.data(), str.size()) != Negate;
+    }
+    double estimateSelectivity() const final {
+        double selectivity = T::selectivity;
+        return Negate ? 1 - selectivity : selectivity;
+    }
+    double estimateCost() const final { return T::cost; }
+    bool mayMatch(uint64_t min, uint64_t max) const final {
+        // Negated restrictions may match anything
+        return Negate || static_cast<const T&>(*this).mayMatchKeys(min, max);
+    }
+    /// Default: No knowledge about the matching strings
+    bool mayMatchKeys(uint64_t min, uint64_t max) const { return true; }
+
+    std::string_view name() const override {
+        return ClassInfo::getName<T>();
+    }
+};
+//---------------------------------------------------------------------------
+/// s = 'value'
+template <bool Negate>
+struct StringEQRestriction final : public StringRestrictionBuilder<StringEQRestriction<Negate>, Negate> {
+    static constexpr double selectivity = 0.01;
+    static constexpr double cost = 2;
+    std::string target;
+
+    explicit StringEQRestriction(std::string_view target) : target(target) {}
+
+    bool mayMatchKeys(uint64_t min, uint64_t max) const {
+        auto key = DataSource::ZoneMap::stringKey(target.data(), target.size());
+        return (min <= key) && (key <= max);
+    }
+
+    [[gnu::always_inline]] inline bool matches(const char* str, size_t len) const {
+        // Most strings are sorted out by their length
+        return (len == target.size()) && (memcmp(str, target.data(), len) == 0);
+    }
+};
+//---------------------------------------------------------------------------
+/// s IN ('value', ...)
+struct StringInRestriction final : public StringRestrictionBuilder<StringInRestriction, false> {
+    static constexpr double selectivity = 0.05;
+    static constexpr double cost = 2;
+    /// The strings
+    std::vector<std::string> targets;
+    /// The lengths of the strings, bit 63 stands for all longer ones
+    uint64_t lengths = 0;
+    /// The hash table of the indexes of the strings, ~0u is empty
+    std::vector<uint32_t> slots;
+    /// The range of the zone map keys of the strings
+    uint64_t minKey = ~0ull, maxKey = 0;
+
+    /// Constructor, the strings are separated by newlines
+    explicit StringInRestriction(std::string_view list) {
+        for (size_t pos = 0; pos <= list.size();) {
+            auto end = std::min(list.find('\n', pos), list.size());
+            targets.emplace_back(list.substr(pos, end - pos));
+            pos = end + 1;
+        }
+        std::sort(targets.begin(), targets.end());
+        targets.erase(std::unique(targets.begin(), targets.end()), targets.end());
+        // At most half of the slots are used
+        slots.resize(size_t(1) << (engine::bit_width(targets.size()) + 1), ~0u);
+        for (uint32_t i = 0; i < targets.size(); i++) {
+            auto& target = targets[i];
+            lengths |= 1ull << std::min<size_t>(target.size(), 63);
+            auto key = DataSource::ZoneMap::stringKey(target.data(), target.size());
+            minKey = std::min(minKey, key);
+            maxKey = std::max(maxKey, key);
+            size_t slot = hash(target.data(), target.size());
+            for (; slots[slot] != ~0u; slot = (slot + 1) & (slots.size() - 1));
+            slots[slot] = i;
+        }
+    }
+
+    /// The home slot of a string
+    size_t hash(const char* str, size_t len) const { return std::hash<std::string_view>{}({str, len}) & (slots.size() - 1); }
+
+    bool mayMatchKeys(uint64_t min, uint64_t max) const { return (min <= maxKey) && (minKey <= max); }
+
+    [[gnu::always_inline]] inline bool matches(const char* str, size_t len) const {
+        // Most strings are sorted out by their length
+        if (!((lengths >> std::min<size_t>(len, 63)) & 1))
+            return false;
+        for (size_t slot = hash(str, len); slots[slot] != ~0u; slot = (slot + 1) & (slots.size() - 1)) {
+            auto& target = targets[slots[slot]];
+            if ((len == target.size()) && (memcmp(str, target.data(), len) == 0))
+                return true;
+        }
+        return false;
+    }
+};
+//---------------------------------------------------------------------------
+/// s LIKE '%value%'
+template <bool Negate>
+struct ContainsRestriction final : public StringRestrictionBuilder<ContainsRestriction<Negate>, Negate> {
+    using Base = StringRestrictionBuilder<ContainsRestriction<Negate>, Negate>;
+    static constexpr double selectivity = 0.1;
+    static constexpr double cost = 3;
+    std::string needle;
+
+    explicit ContainsRestriction(std::string_view needle) : needle(needle) { assert(!needle.empty()); }
+
+    [[gnu::always_inline]] inline bool matches(const char* str, size_t len) const {
+        return (findSubstring(str, str + len, needle) != str + len) && !hasNewline(str, len);
+    }
+    /// Search the contiguous string area of the page at once instead of every string on its own
+    uint64_t runImpl(const char* strings, const uint16_t* offsets, size_t index, uint64_t mask) const {
+        auto [st, en] = std::pair<size_t, size_t>{engine::countr_zero(mask), 64 - engine::countl_zero(mask)};
+        // The gaps between sparse strings are not worth scanning
+        if (static_cast<size_t>(engine::popcount(mask)) * 4 < en - st)
+            return Base::runImpl(strings, offsets, index, mask);
+
+        auto beginOf = [&](size_t bit) -> size_t { return (index + bit) ? offsets[index + bit - 1] : 0; };
+        const uint16_t* ends = offsets + index;
+        const char* cur = strings + beginOf(st);
+        const char* end = strings + ends[en - 1];
+        uint64_t matches = 0;
+        for (size_t bit = st;;) {
+            const char* hit = findSubstring(cur, end, needle);
+            if (hit == end)
+                break;
+            size_t pos = hit - strings;
+            while (ends[bit] <= pos)
+                bit++;
+            assert(bit < en);
+            // A match that crosses into the next string is not a match, later ones in the same string neither
+            if (pos + needle.size() <= ends[bit]) {
+                size_t begin = beginOf(bit);
+                matches |= static_cast<uint64_t>(!hasNewline(strings + begin, ends[bit] - begin)) << bit;
+            }
+            cur = strings + ends[bit];
+            if (++bit == en)
+                break;
+        }
+        return matches & mask;
+    }
+};
+//---------------------------------------------------------------------------
+/// s LIKE 'prefix%middle%...%suffix'
+template <bool Negate>
+struct SegmentRestriction final : public StringRestrictionBuilder<SegmentRestriction<Negate>, Negate> {
+    static constexpr double selectivity = 0.1;
+    static constexpr double cost = 3;
+    std::string prefix;
+    std::string suffix;
+    std::vector<std::string> middle;
+    size_t minLength;
+
+    explicit SegmentRestriction(std::string_view pattern) {
+        auto first = pattern.find('%'), last = pattern.rfind('%');
+        assert(first != std::string_view::npos);
+        prefix = pattern.substr(0, first);
+        suffix = pattern.substr(last + 1);
+        minLength = prefix.size() + suffix.size();
+        for (size_t pos = first + 1; pos <= last;) {
+            auto next = pattern.find('%', pos);
+            if (next != pos) {
+                middle.emplace_back(pattern.substr(pos, next - pos));
+                minLength += middle.back().size();
+            }
+            pos = next + 1;
+        }
+    }
+
+    bool mayMatchKeys(uint64_t min, uint64_t max) const {
+        // All strings starting with the prefix have keys between the zero padded and the one padded prefix
+        auto lower = DataSource::ZoneMap::stringKey(prefix.data(), prefix.size());
+        auto upper = prefix.size() >= sizeof(uint64_t) ? lower : lower | (~0ull >> (prefix.size() * 8));
+        return (lower <= max) && (min <= upper);
+    }
+
+    [[gnu::always_inline]] inline bool matches(const char* str, size_t len) const {
+        if (len < minLength)
+            return false;
+        if (memcmp(str, prefix.data(), prefix.size()) || memcmp(str + len - suffix.size(), suffix.data(), suffix.size()))
+            return false;
+        // Match the middle parts greedily between prefix and suffix
+        const char* cur = str + prefix.size();
+        const char* end = str + len - suffix.size();
+        for (auto& part : middle) {
+            cur = findSubstring(cur, end, part);
+            if (cur == end)
+                return false;
+            cur += part.size();
+        }
+        return !hasNewline(str, len);
+    }
+};
+//---------------------------------------------------------------------------
+/// Any other LIKE pattern, i.e., with '_'
+template <bool Negate>
+struct LikeRestriction final : public StringRestrictionBuilder<LikeRestriction<Negate>, Negate> {
+    static constexpr double selectivity = 0.1;
+    static constexpr double cost = 8;
+    std::string pattern;
+
+    explicit LikeRestriction(std::string_view pattern) : pattern(pattern) {}
+
+    [[gnu::always_inline]] inline bool matches(const char* str, size_t len) const {
+        return StringRestrictionLogic::like({str, len}, pattern);
+    }
+};
+//---------------------------------------------------------------------------
+/// Two restrictions on the same column
+struct ConjunctionRestriction final : public StringRestrictionLogic {
+    UniquePtr<StringRestrictionLogic> first;
+    UniquePtr<StringRestrictionLogic> second;
+
+    ConjunctionRestriction(UniquePtr<StringRestrictionLogic> first, UniquePtr<StringRestrictionLogic> second) : first(std::move(first)), second(std::move(second)) {
+        // Run the cheaper and more selective restriction first
+        if ((1 - this->first->estimateSelectivity()) / this->first->estimateCost() < (1 - this->second->estimateSelectivity()) / this->second->estimateCost())
+            std::swap(this->first, this->second);
+    }
+
+    uint64_t run(const char* strings, const uint16_t* offsets, size_t index, uint64_t mask) const final {
+        return second->run(strings, offsets, index, first->run(strings, offsets, index, mask));
+    }
+    bool check(std::string_view str) const final { return first->check(str) && second->check(str); }
+    double estimateSelectivity() const final { return first->estimateSelectivity() * second->estimateSelectivity(); }
+    double estimateCost() const final { return first->estimateCost() + first->estimateSelectivity() * second->estimateCost(); }
+    bool mayMatch(uint64_t min, uint64_t max) const final { return first->mayMatch(min, max) && second->mayMatch(min, max); }
+
+    std::string_view name() const override {
+        return ClassInfo::getName<ConjunctionRestriction>();
+    }
+};
+//---------------------------------------------------------------------------
+template <bool Negate>
+static UniquePtr<StringRestrictionLogic> setupLike(std::string_view pattern) {
+    if (pattern.find('_') != std::string_view::npos)
+        return makeUnique<LikeRestriction<Negate>>(pattern);
+    auto first = pattern.find('%');
+    // Without wildcards, this is a comparison
+    if (first == std::string_view::npos)
+        return makeUnique<StringEQRestriction<Negate>>(pattern);
+    auto last = pattern.find_last_not_of('%');
+    if (first == 0 && last != std::string_view::npos) {
+        auto start = pattern.find_first_not_of('%');
+        auto needle = pattern.substr(start, last + 1 - start);
+        if (pattern.substr(last + 1).size() > 0 && needle.find('%') == std::string_view::npos)
+            return makeUnique<ContainsRestriction<Negate>>(needle);
+    }
+    return makeUnique<SegmentRestriction<Negate>>(pattern);
+}
+//---------------------------------------------------------------------------
+UniquePtr<StringRestrictionLogic> StringRestrictionLogic::setupRestriction(const Restriction& restriction) {
+    assert(restriction.type == Restriction::StringIn || restriction.pattern.find('\n') == std::string_view::npos);
+    switch (restriction.type) {
+        case Restriction::StringEq: return makeUnique<StringEQRestriction<false>>(restriction.pattern);
+        case Restriction::StringNeq: return makeUnique<StringEQRestriction<true>>(restriction.pattern);
+        case Restriction::StringIn: return makeUnique<StringInRestriction>(restriction.pattern);
+        case Restriction::Like: return setupLike<false>(restriction.pattern);
+        case Restriction::NotLike: return setupLike<true>(restriction.pattern);
+        default: break;
+    }
+    assert(false && "Not a string restriction");
+    __builtin_unreachable();
+}
+//---------------------------------------------------------------------------
+UniquePtr<StringRestrictionLogic> StringRestrictionLogic::conjunction(UniquePtr<StringRestrictionLogic> first, UniquePtr<StringRestrictionLogic> second) {
+    return makeUnique<ConjunctionRestriction>(std::move(first), std::move(second));
+}
+//---------------------------------------------------------------------------
+}
+//---------------------------------------------------------------------------
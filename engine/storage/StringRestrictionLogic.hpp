@@ -0,0 +1,48 @@
+#pragma once
+//---------------------------------------------------------------------------
+#include "infra/QueryMemory.hpp"
+#include "storage/StringPtr.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+//---------------------------------------------------------------------------
+namespace engine {
+//---------------------------------------------------------------------------
+struct Restriction;
+//---------------------------------------------------------------------------
+/// Restrictions on VARCHAR columns that work directly on the short string layout of a page
+class StringRestrictionLogic {
+    public:
+    /// Filter the masked strings of a page and return a bitset mask. Bit i of the mask refers to the string at non-null index `index + i`.
+    /// String j spans [offsets[j - 1], offsets[j]) in strings, the first string of a page starts at 0
+    virtual uint64_t run(const char* strings, const uint16_t* offsets, size_t index, uint64_t mask) const = 0;
+    /// Check a single string
+    virtual bool check(std::string_view str) const = 0;
+    /// Estimate the selectivity very broadly
+    virtual double estimateSelectivity() const = 0;
+    virtual double estimateCost() const = 0;
+    /// Could any string whose DataSource::ZoneMap::stringKey lies in [min, max] pass? Used to skip pages by their zone map
+    virtual bool mayMatch(uint64_t min, uint64_t max) const { return true; }
+    /// Destructor
+    virtual ~StringRestrictionLogic() noexcept = default;
+
+    /// Check a string that may be a long string spanning multiple pages
+    bool check(StringPtr str) const {
+        if (str.is_long()) [[unlikely]]
+            return check(std::string_view{str.materialize_string()});
+        return check(str.strView());
+    }
+
+    /// Setup a restriction logic given a string restriction
+    static UniquePtr<StringRestrictionLogic> setupRestriction(const Restriction& restriction);
+    /// Combine two restrictions on the same column
+    static UniquePtr<StringRestrictionLogic> conjunction(UniquePtr<StringRestrictionLogic> first, UniquePtr<StringRestrictionLogic> second);
+    /// Evaluate a LIKE pattern. '%' and '_' match any sequence and any single character except for newlines, just like the regular expressions in statement.h
+    static bool like(std::string_view str, std::string_view pattern);
+
+    virtual std::string_view name() const = 0;
+};
+//---------------------------------------------------------------------------
+}
+//---------------------------------------------------------------------------
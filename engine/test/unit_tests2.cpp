@@ -1,16 +1,32 @@
+#include "Execute.hpp"
 #include "attribute.h"
 #include "infra/Random.hpp"
 #include "infra/Scheduler.hpp"
+#include "infra/helper/BitOps.hpp"
 #include "op/Hashtable.hpp"
 #include "op/ScanBase.hpp"
 #include "op/TableScan.hpp"
 #include "op/TableTarget.hpp"
 #include "pipeline/JoinPipeline.hpp"
+#include "query/CSVLoader.hpp"
+#include "query/CostModel.hpp"
+#include "query/DPccp.hpp"
 #include "query/PlanImport.hpp"
+#include "query/QueryGraph.hpp"
+#include "query/Restriction.hpp"
 #include "query/RuntimeValue.hpp"
+#include "storage/BitPacking.hpp"
+#include "storage/ColumnStatistics.hpp"
+#include "storage/RestrictionLogic.hpp"
 #include "storage/StringPtr.hpp"
+#include "storage/StringRestrictionLogic.hpp"
 #include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
 #include <iostream>
+#include <limits>
 #include <mutex>
 #include <set>
 #include <variant>
@@ -206,6 +222,134 @@ TEST_CASE("HashTable") {
     for (auto& n : notInHT) {
         CHECK(!ht2.joinFilterPrecise(n));
     }
+
+    // the tuples of a key are found by iterating its chain
+    for (auto& tuple : vR0) {
+        size_t matches = 0;
+        ht2.iterateMatches(tuple[0], [&](const uint64_t* entry) {
+            CHECK(entry[Hashtable::keyOffset] == tuple[0]);
+            matches++;
+        });
+        CHECK(matches == 1);
+    }
+    size_t falseMatches = 0;
+    for (auto& n : notInHT)
+        ht2.iterateMatches(n, [&](const uint64_t*) { falseMatches++; });
+    CHECK(falseMatches == 0);
+}
+
+TEST_CASE("ResultSink") {
+    // An empty result still reaches the sink as a chunk with the output columns
+    auto* context = Contest::build_context();
+    vector<vector<PlanImport::Data>> left, right;
+    for (int i = 0; i < 100; i++) {
+        left.push_back({i});
+        right.push_back({i + 1000});
+    }
+    auto leftTable = PlanImport::makeTable(left, {DataType::INT32});
+    auto rightTable = PlanImport::makeTable(right, {DataType::INT32});
+    DataSource db;
+    db.relations.push_back(leftTable->table);
+    db.relations.push_back(rightTable->table);
+
+    Plan plan;
+    plan.new_scan_node(0, {{0, DataType::INT32}});
+    plan.new_scan_node(1, {{0, DataType::INT32}});
+    plan.new_join_node(true, 0, 1, 0, 0, {{0, DataType::INT32}, {1, DataType::INT32}});
+    plan.root = 2;
+    std::mutex mutex;
+    size_t numChunks = 0, numRows = 0, numColumns = 0;
+    engine::execute(PlanImport::importPlanExistingData(db, plan), [&](ColumnarTable& chunk) {
+        std::unique_lock lock(mutex);
+        numChunks++;
+        numRows += chunk.num_rows;
+        numColumns = chunk.columns.size();
+    }, context);
+    REQUIRE(numChunks == 1);
+    REQUIRE(numRows == 0);
+    REQUIRE(numColumns == 2);
+    Contest::destroy_context(context);
+}
+
+TEST_CASE("DistinctTarget") {
+    ContextWrapper context{};
+
+    DistinctTarget dt({DataType::INT32, DataType::VARCHAR}, 1000);
+    // Equal strings at different locations must be detected as duplicates
+    vector<string> strings;
+    strings.reserve(4000);
+    set<pair<int32_t, string>> expected;
+    {
+        DistinctTarget::LocalState ls1(dt);
+        DistinctTarget::LocalState ls2(dt);
+        for (unsigned i = 0; i < 4000; i++) {
+            auto& str = strings.emplace_back("string" + to_string(i % 30));
+            expected.emplace(i % 7, str);
+            dt((i % 2) ? ls1 : ls2, 1, i % 7, StringPtr::fromString(str).val());
+            dt(ls1, 1, RuntimeValue::nullValue, RuntimeValue::nullValue);
+        }
+        dt.finishConsume();
+    }
+    const auto table = dt.output.extract();
+    const auto data = Table::from_columnar(table).table();
+    REQUIRE(data.size() == expected.size() + 1);
+    set<pair<int32_t, string>> found;
+    for (auto& row : data) {
+        if (std::holds_alternative<std::monostate>(row[0])) {
+            REQUIRE(std::holds_alternative<std::monostate>(row[1]));
+            continue;
+        }
+        found.emplace(std::get<int32_t>(row[0]), std::get<string>(row[1]));
+    }
+    REQUIRE(found == expected);
+    dt.output.localStates.clear();
+
+    // Negative zero is equal to zero
+    DistinctTarget doubles({DataType::FP64}, 100);
+    {
+        DistinctTarget::LocalState ls(doubles);
+        for (uint64_t value : {uint64_t{0}, uint64_t{1} << 63, uint64_t{0x3ff8000000000000}, uint64_t{1} << 63, RuntimeValue::nullValue})
+            doubles(ls, 1, value);
+        doubles.finishConsume();
+    }
+    const auto doubleData = Table::from_columnar(doubles.output.extract()).table();
+    REQUIRE(doubleData.size() == 3);
+    doubles.output.localStates.clear();
+}
+
+TEST_CASE("DistinctQuery") {
+    // The VARCHAR output reaches the distinct output only through the hash table of the dimension
+    auto* context = Contest::build_context();
+    vector<vector<PlanImport::Data>> dimension, fact;
+    for (int i = 0; i < 100; i++)
+        dimension.push_back({i, "a rather long dimension name " + to_string(i % 10)});
+    for (int i = 0; i < 10000; i++)
+        fact.push_back({i % 200});
+    auto dimensionTable = PlanImport::makeTable(dimension, {DataType::INT32, DataType::VARCHAR});
+    auto factTable = PlanImport::makeTable(fact, {DataType::INT32});
+    DataSource db;
+    db.relations.push_back(dimensionTable->table);
+    db.relations.push_back(factTable->table);
+
+    Plan plan;
+    plan.new_scan_node(0, {{0, DataType::INT32}, {1, DataType::VARCHAR}});
+    plan.new_scan_node(1, {{0, DataType::INT32}});
+    plan.new_join_node(true, 0, 1, 0, 0, {{1, DataType::VARCHAR}});
+    plan.root = 2;
+    for (bool distinct : {false, true}) {
+        auto result = engine::execute(PlanImport::importPlanExistingData(db, plan, {}, distinct), context);
+        auto rows = Table::from_columnar(result).table();
+        REQUIRE(rows.size() == (distinct ? 10 : 5000));
+        set<string> names;
+        for (auto& row : rows) {
+            REQUIRE(std::holds_alternative<string>(row[0]));
+            names.insert(std::get<string>(row[0]));
+        }
+        REQUIRE(names.size() == 10);
+        REQUIRE(*names.begin() == "a rather long dimension name 0");
+        REQUIRE(*names.rbegin() == "a rather long dimension name 9");
+    }
+    Contest::destroy_context(context);
 }
 
 TEST_CASE("HashJoin") {
@@ -413,6 +557,515 @@ TEST_CASE("TableScan") {
              {6, longstr},
              {7, "c"}});
     }
+    SECTION("late materialization") {
+        string longstr(32'000, 'a');
+        vector<vector<PlanImport::Data>> data;
+        for (int i = 0; i < 5000; i++)
+            data.push_back({i, (i % 5 == 0) ? PlanImport::Data{std::monostate{}} : PlanImport::Data{(i == 42) ? longstr : to_string(i)}});
+        auto tbl = PlanImport::makeTable(data, {DataType::INT32, DataType::VARCHAR});
+        auto tblInfo = TableScan::makeTableInfo(tbl->table);
+        TableScan scan(tblInfo);
+        scan.lateMaterialized = 2;
+        struct LS {
+            TableScan::LocalState scan;
+
+            LS(TableScan& scan) : scan(scan) {}
+        };
+        vector<LS> ls;
+        ls.reserve(scan.concurrency());
+        for (unsigned i = 0; i < scan.concurrency(); i++)
+            ls.emplace_back(scan);
+        std::mutex mutex;
+        vector<pair<uint64_t, uint64_t>> rows;
+        scan([&](size_t workerId) { return &ls[workerId]; }, [&](auto, auto&& provider) {
+            std::unique_lock lock(mutex);
+            rows.emplace_back(provider(0), provider(1)); }, [](auto, auto) {}, [](auto, auto, auto) {});
+        REQUIRE(rows.size() == data.size());
+
+        // Resolve the row ids in reverse order to require random access
+        std::sort(rows.begin(), rows.end(), std::greater{});
+        vector<uint64_t> values;
+        for (auto& row : rows) {
+            REQUIRE(row.first == row.second);
+            values.push_back(row.second);
+        }
+        LateMaterializer materializer(*tblInfo.columns[1]);
+        materializer.clone()->resolve(values.data(), values.size());
+        for (size_t i = 0; i < rows.size(); i++) {
+            auto& expected = data[rows[i].first][1];
+            if (std::holds_alternative<std::monostate>(expected))
+                REQUIRE(values[i] == TableScan::nullValue);
+            else
+                REQUIRE(StringPtr{values[i]}.materialize_string() == std::get<string>(expected));
+        }
+    }
+    SECTION("string restrictions") {
+        string longstr(32'000, 'a');
+        longstr += "(voice)";
+        const char* words[] = {"foo", "bar", "(voice)", "", "x", "line\nbreak"};
+        vector<vector<PlanImport::Data>> data;
+        for (int i = 0; i < 5000; i++) {
+            string str = string(words[i % 6]) + words[(i / 6) % 6] + to_string(i % 7);
+            data.push_back({i, (i % 5 == 0) ? PlanImport::Data{std::monostate{}} : PlanImport::Data{(i == 42) ? longstr : str}});
+        }
+        auto tbl = PlanImport::makeTable(data, {DataType::INT32, DataType::VARCHAR});
+        auto tblInfo = TableScan::makeTableInfo(tbl->table);
+
+        vector<pair<Restriction::Type, string>> restrictions{
+            {Restriction::StringEq, "foobar3"},
+            {Restriction::StringNeq, "foobar3"},
+            {Restriction::Like, "%(voice)%"},
+            {Restriction::NotLike, "%(voice)%"},
+            {Restriction::Like, "foo%"},
+            {Restriction::Like, "%ar_"},
+            {Restriction::Like, "%o%b%"},
+        };
+        for (auto& [type, pattern] : restrictions) {
+            Restriction restriction{type, {}};
+            restriction.pattern = pattern;
+            auto logic = StringRestrictionLogic::setupRestriction(restriction);
+            TableScan scan(tblInfo, {0}, {TableScan::RestrictionInfo{1, 0.5, nullptr, logic.get()}}, 1, 1);
+            struct LS {
+                TableScan::LocalState scan;
+
+                LS(TableScan& scan) : scan(scan) {}
+            };
+            vector<LS> ls;
+            ls.reserve(scan.concurrency());
+            for (unsigned i = 0; i < scan.concurrency(); i++)
+                ls.emplace_back(scan);
+            std::mutex mutex;
+            set<uint64_t> rows;
+            scan([&](size_t workerId) { return &ls[workerId]; }, [&](auto, auto&& provider) {
+                std::unique_lock lock(mutex);
+                rows.insert(provider(0)); }, [](auto, auto) {}, [](auto, auto, auto) {});
+
+            set<uint64_t> expected;
+            for (size_t i = 0; i < data.size(); i++) {
+                if (std::holds_alternative<std::monostate>(data[i][1]))
+                    continue;
+                auto& str = std::get<string>(data[i][1]);
+                bool equal = str == pattern;
+                bool like = Comparison::like_match(str, pattern);
+                if ((type == Restriction::StringEq) ? equal : (type == Restriction::StringNeq) ? !equal : (type == Restriction::Like) ? like : !like)
+                    expected.insert(i);
+            }
+            REQUIRE(rows == expected);
+        }
+    }
+    SECTION("selection vectors") {
+        // The selective first restriction switches the scan to the selection vector mode
+        vector<vector<PlanImport::Data>> data;
+        for (int i = 0; i < 200000; i++)
+            data.push_back({i, (i % 11 == 0) ? PlanImport::Data{std::monostate{}} : PlanImport::Data{i % 97}, (i % 5 == 0) ? PlanImport::Data{std::monostate{}} : PlanImport::Data{to_string(i)}});
+        auto tbl = PlanImport::makeTable(data, {DataType::INT32, DataType::INT32, DataType::VARCHAR});
+        auto tblInfo = TableScan::makeTableInfo(tbl->table);
+
+        Restriction eq{Restriction::Eq, RuntimeValue::from(DataType::INT32, 5)};
+        auto eqLogic = RestrictionLogic::setupRestriction(eq);
+        Restriction range{Restriction::Range, RuntimeValue::from(DataType::INT32, 0)};
+        range.upper = 99999;
+        auto rangeLogic = RestrictionLogic::setupRestriction(range);
+        Restriction like{Restriction::Like, {}};
+        like.pattern = "%3%";
+        auto likeLogic = StringRestrictionLogic::setupRestriction(like);
+        TableScan scan(tblInfo, {0, 1}, {{1, 0.01, eqLogic.get()}, {0, 0.5, rangeLogic.get()}, {2, 0.5, nullptr, likeLogic.get()}}, 1, 1);
+        struct LS {
+            TableScan::LocalState scan;
+
+            LS(TableScan& scan) : scan(scan) {}
+        };
+        vector<LS> ls;
+        ls.reserve(scan.concurrency());
+        for (unsigned i = 0; i < scan.concurrency(); i++)
+            ls.emplace_back(scan);
+        std::mutex mutex;
+        set<pair<uint64_t, uint64_t>> rows;
+        scan([&](size_t workerId) { return &ls[workerId]; }, [&](auto, auto&& provider) {
+            std::unique_lock lock(mutex);
+            rows.emplace(provider(0), provider(1)); }, [](auto, auto) {}, [](auto, auto, auto) {});
+
+        set<pair<uint64_t, uint64_t>> expected;
+        for (uint64_t i = 0; i < 100000; i++)
+            if (i % 11 != 0 && i % 97 == 5 && i % 5 != 0 && to_string(i).find('3') != string::npos)
+                expected.emplace(i, 5);
+        REQUIRE(rows == expected);
+    }
+    SECTION("double restrictions") {
+        // Like SQL, -0.0 equals 0.0 and NaN is larger than all other values
+        double nan = std::numeric_limits<double>::quiet_NaN(), inf = std::numeric_limits<double>::infinity();
+        REQUIRE(Restriction::doubleKey(-0.0) == Restriction::doubleKey(0.0));
+        REQUIRE(Restriction::doubleKey(-inf) < Restriction::doubleKey(-1.0));
+        REQUIRE(Restriction::doubleKey(-1.0) < Restriction::doubleKey(0.0));
+        REQUIRE(Restriction::doubleKey(inf) < Restriction::doubleKey(nan));
+        REQUIRE(Restriction::doubleKey(-nan) == Restriction::doubleKey(nan));
+
+        const double specials[] = {0.0, -0.0, nan, inf, -inf, 1.5, -1.5};
+        vector<vector<PlanImport::Data>> data;
+        for (int i = 0; i < 20000; i++)
+            data.push_back({i, (i % 9 == 0) ? PlanImport::Data{std::monostate{}} : (i % 4 == 0) ? PlanImport::Data{specials[i % 7]} : PlanImport::Data{double(i % 201 - 100) / 4}});
+        auto tbl = PlanImport::makeTable(data, {DataType::INT32, DataType::FP64});
+        auto tblInfo = TableScan::makeTableInfo(tbl->table);
+
+        auto key = [](double value) { return Restriction::doubleKey(value); };
+        // x < 0, x >= 0, x = -0.0, x > 1.5, x = NaN, x <= inf, -10 <= x <= 10
+        vector<pair<uint64_t, uint64_t>> ranges{{0, key(0.0) - 1}, {key(0.0), ~0ull}, {key(-0.0), key(-0.0)}, {key(1.5) + 1, ~0ull}, {key(nan), key(nan)}, {0, key(inf)}, {key(-10.0), key(10.0)}};
+        for (auto [lower, upper] : ranges) {
+            Restriction restriction{Restriction::DoubleRange, RuntimeValue::from(DataType::FP64, lower)};
+            restriction.upper = upper;
+            auto logic = RestrictionLogic::setupRestriction(restriction);
+            REQUIRE(logic);
+            TableScan scan(tblInfo, {0, 1}, {TableScan::RestrictionInfo{1, 0.5, logic.get()}}, 1, 1);
+            struct LS {
+                TableScan::LocalState scan;
+
+                LS(TableScan& scan) : scan(scan) {}
+            };
+            vector<LS> ls;
+            ls.reserve(scan.concurrency());
+            for (unsigned i = 0; i < scan.concurrency(); i++)
+                ls.emplace_back(scan);
+            std::mutex mutex;
+            set<pair<uint64_t, uint64_t>> rows;
+            scan([&](size_t workerId) { return &ls[workerId]; }, [&](auto, auto&& provider) {
+                std::unique_lock lock(mutex);
+                rows.emplace(provider(0), provider(1)); }, [](auto, auto) {}, [](auto, auto, auto) {});
+
+            set<pair<uint64_t, uint64_t>> expected;
+            for (size_t i = 0; i < data.size(); i++) {
+                if (std::holds_alternative<std::monostate>(data[i][1]))
+                    continue;
+                double value = std::get<double>(data[i][1]);
+                if (lower <= key(value) && key(value) <= upper)
+                    expected.emplace(i, engine::bit_cast<uint64_t>(value));
+            }
+            REQUIRE(rows == expected);
+        }
+    }
+    SECTION("in lists") {
+        vector<vector<PlanImport::Data>> data;
+        for (int i = 0; i < 50000; i++)
+            data.push_back({i, (i % 7 == 0) ? PlanImport::Data{std::monostate{}} : PlanImport::Data{(i * 7919) % 100003}, (i % 5 == 0) ? PlanImport::Data{std::monostate{}} : PlanImport::Data{to_string(i % 1000)}});
+        auto tbl = PlanImport::makeTable(data, {DataType::INT32, DataType::INT32, DataType::VARCHAR});
+        auto tblInfo = TableScan::makeTableInfo(tbl->table);
+
+        auto runScan = [&](const TableScan::RestrictionInfo& info) {
+            TableScan scan(tblInfo, {0}, {info}, 1, 1);
+            struct LS {
+                TableScan::LocalState scan;
+
+                LS(TableScan& scan) : scan(scan) {}
+            };
+            vector<LS> ls;
+            ls.reserve(scan.concurrency());
+            for (unsigned i = 0; i < scan.concurrency(); i++)
+                ls.emplace_back(scan);
+            std::mutex mutex;
+            set<uint64_t> rows;
+            scan([&](size_t workerId) { return &ls[workerId]; }, [&](auto, auto&& provider) {
+                std::unique_lock lock(mutex);
+                rows.emplace(provider(0)); }, [](auto, auto) {}, [](auto, auto, auto) {});
+            return rows;
+        };
+
+        // Small lists use SIMD compares or perfect hashing, dense lists a bitmap and sparse lists a hash set
+        for (unsigned size : {3u, 12u, 200u, 2000u}) {
+            for (uint64_t stride : {1ull, 3ull, 1000003ull}) {
+                vector<uint64_t> values;
+                for (uint64_t i = 0; i < size; i++)
+                    values.push_back((i * stride * 31) % 100003 + (stride > 100003 ? i * stride : 0));
+                std::sort(values.begin(), values.end());
+                values.erase(std::unique(values.begin(), values.end()), values.end());
+                Restriction restriction{Restriction::In, RuntimeValue::from(DataType::INT32, 0)};
+                restriction.values = values;
+                auto logic = RestrictionLogic::setupRestriction(restriction);
+                REQUIRE(logic);
+                auto rows = runScan({1, 0.1, logic.get()});
+
+                set<uint64_t> expected;
+                for (size_t i = 0; i < data.size(); i++)
+                    if (!std::holds_alternative<std::monostate>(data[i][1]) && std::binary_search(values.begin(), values.end(), std::get<int>(data[i][1])))
+                        expected.emplace(i);
+                REQUIRE(rows == expected);
+            }
+        }
+
+        Restriction restriction{Restriction::StringIn, {}};
+        restriction.pattern = "12\n999\nnope\n";
+        auto logic = StringRestrictionLogic::setupRestriction(restriction);
+        auto rows = runScan({2, 0.1, nullptr, logic.get()});
+        set<uint64_t> expected;
+        for (size_t i = 0; i < data.size(); i++)
+            if (i % 5 != 0 && (i % 1000 == 12 || i % 1000 == 999))
+                expected.emplace(i);
+        REQUIRE(rows == expected);
+    }
+    SECTION("samples") {
+        vector<vector<PlanImport::Data>> data;
+        for (int i = 0; i < 30000; i++)
+            data.push_back({(i % 7 == 0) ? PlanImport::Data{std::monostate{}} : PlanImport::Data{i}, (i % 5 == 0) ? PlanImport::Data{std::monostate{}} : PlanImport::Data{to_string(i % 10)}});
+        auto tbl = PlanImport::makeTable(data, {DataType::INT32, DataType::VARCHAR});
+        auto tblInfo = TableScan::makeTableInfo(tbl->table);
+
+        // 100 rows, one of every stratum of 300 rows. The last word of the matches is partial
+        vector<uint64_t> rowIds;
+        for (uint64_t i = 0; i < 100; i++)
+            rowIds.push_back(i * 300 + (i * 37) % 300);
+        vector<uint32_t> values(128, static_cast<uint32_t>(RuntimeValue::nullValue));
+        TableScan::sampleColumn(*tblInfo.columns[0], rowIds, values.data());
+        for (size_t i = 0; i < rowIds.size(); i++)
+            REQUIRE(values[i] == ((rowIds[i] % 7 == 0) ? static_cast<uint32_t>(RuntimeValue::nullValue) : rowIds[i]));
+
+        Restriction stringRestriction{Restriction::StringIn, {}};
+        stringRestriction.pattern = "3\n4";
+        auto stringLogic = StringRestrictionLogic::setupRestriction(stringRestriction);
+        Restriction range{Restriction::Range, RuntimeValue::from(DataType::INT32, 0)};
+        range.upper = 20000;
+        auto rangeLogic = RestrictionLogic::setupRestriction(range);
+        TableScan scan(tblInfo, {0}, {TableScan::RestrictionInfo{1, 0.1, nullptr, stringLogic.get()}, TableScan::RestrictionInfo{0, 0.5, rangeLogic.get()}}, 1, 1);
+        vector<uint64_t> matches{~0ull, ~0ull >> 28};
+        scan.filterSample(rowIds, matches.data());
+        rangeLogic->runWords(values.data(), matches.data(), matches.size());
+        for (size_t i = 0; i < 128; i++) {
+            auto row = i < rowIds.size() ? rowIds[i] : 0;
+            bool expected = (i < rowIds.size()) && (row % 5 != 0) && (row % 10 == 3 || row % 10 == 4) && (row % 7 != 0) && (row <= 20000);
+            REQUIRE(((matches[i / 64] >> (i % 64)) & 1) == expected);
+        }
+    }
+    SECTION("zone maps") {
+        vector<vector<PlanImport::Data>> data;
+        for (int i = 0; i < 20000; i++) {
+            auto str = to_string(100000 + i);
+            data.push_back({i, (i >= 5000 && i < 8000) ? PlanImport::Data{std::monostate{}} : PlanImport::Data{str}});
+        }
+        auto tbl = PlanImport::makeTable(data, {DataType::INT32, DataType::VARCHAR});
+        auto file = (std::filesystem::temp_directory_path() / "zonemaps.cache.db").string();
+        {
+            DataSource db;
+            db.relations.push_back(tbl->table);
+            std::move(db).serialize(file);
+        }
+        auto db = DataSource::deserialize(file);
+        std::filesystem::remove(file);
+        auto& table = db.relations[0];
+        for (auto& column : table.columns) {
+            REQUIRE(column.mapped);
+            REQUIRE(column.zoneMaps.size() == column.pages.size());
+            for (size_t i = 0; i < column.pages.size(); i++) {
+                auto expected = DataSource::ZoneMap::compute(column.type, *column.pages[i], column.bitPacked);
+                REQUIRE(column.zoneMaps[i].min == expected.min);
+                REQUIRE(column.zoneMaps[i].max == expected.max);
+            }
+        }
+        REQUIRE(table.columns[0].zoneMaps[0].min == 0);
+        auto tblInfo = TableScan::makeTableInfo(table);
+
+        auto scanRows = [&](TableScan::RestrictionInfo restriction) {
+            TableScan scan(tblInfo, {0}, {restriction}, 1, 1);
+            struct LS {
+                TableScan::LocalState scan;
+
+                LS(TableScan& scan) : scan(scan) {}
+            };
+            vector<LS> ls;
+            ls.reserve(scan.concurrency());
+            for (unsigned i = 0; i < scan.concurrency(); i++)
+                ls.emplace_back(scan);
+            std::mutex mutex;
+            set<uint64_t> rows;
+            scan([&](size_t workerId) { return &ls[workerId]; }, [&](auto, auto&& provider) {
+                std::unique_lock lock(mutex);
+                rows.insert(provider(0)); }, [](auto, auto) {}, [](auto, auto, auto) {});
+            return rows;
+        };
+        auto expectRange = [](uint64_t from, uint64_t to) {
+            set<uint64_t> expected;
+            for (auto i = from; i < to; i++)
+                if (i < 5000 || i >= 8000)
+                    expected.insert(i);
+            return expected;
+        };
+
+        Restriction range{Restriction::Range, RuntimeValue::from(DataType::INT32, 12000)};
+        range.upper = 12099;
+        auto rangeLogic = RestrictionLogic::setupRestriction(range);
+        REQUIRE(scanRows({0, 0.1, rangeLogic.get()}) == expectRange(12000, 12100));
+        REQUIRE(scanRows({1, 0.9, RestrictionLogic::notNullRestriction}) == expectRange(0, data.size()));
+
+        Restriction like{Restriction::Like, {}};
+        like.pattern = "1071%";
+        auto likeLogic = StringRestrictionLogic::setupRestriction(like);
+        REQUIRE(scanRows({1, 0.1, nullptr, likeLogic.get()}) == expectRange(7100, 7200));
+        Restriction eq{Restriction::StringEq, {}};
+        eq.pattern = "119999";
+        auto eqLogic = StringRestrictionLogic::setupRestriction(eq);
+        REQUIRE(scanRows({1, 0.1, nullptr, eqLogic.get()}) == expectRange(19999, 20000));
+    }
+    SECTION("read ahead pages") {
+        // Five pages and the third one is empty. The offsets are the first rows of the pages, followed by the number of rows
+        vector<DataSource::Page*> pages(5, nullptr);
+        uint32_t offsets[] = {0, 100, 200, 200, 300, 350};
+        TableScan::ColumnInfo column{};
+        column.pages = pages;
+        column.pageOffsets = offsets;
+        using Range = pair<size_t, size_t>;
+        REQUIRE(TableScan::getPageRange(column, 0, 100) == Range{0, 1});
+        REQUIRE(TableScan::getPageRange(column, 50, 150) == Range{0, 2});
+        REQUIRE(TableScan::getPageRange(column, 100, 200) == Range{1, 2});
+        REQUIRE(TableScan::getPageRange(column, 200, 300) == Range{3, 4});
+        REQUIRE(TableScan::getPageRange(column, 0, 350) == Range{0, 5});
+        // The last morsel is partial, its end is either clamped to the number of rows or beyond it
+        REQUIRE(TableScan::getPageRange(column, 300, 350) == Range{4, 5});
+        REQUIRE(TableScan::getPageRange(column, 300, 400) == Range{4, 5});
+
+        // The morsels of a real column cover each page, the last one is partial
+        constexpr size_t numRows = 100000, morselSize = 3000;
+        vector<vector<PlanImport::Data>> data;
+        for (size_t i = 0; i < numRows; i++)
+            data.push_back({static_cast<int32_t>(i)});
+        auto tbl = PlanImport::makeTable(data, {DataType::INT32});
+        auto info = TableScan::prepareColumn(numRows, tbl->table.columns[0]);
+        REQUIRE(info.pages.size() > 10);
+        REQUIRE(info.readAheadPages == &tbl->table.columns[0].readAhead.pages);
+        size_t covered = 0;
+        for (size_t row = 0; row < numRows; row += morselSize) {
+            size_t end = std::min(row + morselSize, numRows);
+            auto [first, last] = TableScan::getPageRange(info, row, end);
+            REQUIRE(first < last);
+            REQUIRE(info.pageOffsets[first] <= row);
+            REQUIRE(row < info.pageOffsets[first + 1]);
+            REQUIRE(info.pageOffsets[last - 1] < end);
+            REQUIRE(end <= info.pageOffsets[last]);
+            REQUIRE(first <= covered);
+            covered = last;
+        }
+        REQUIRE(covered == info.pages.size());
+    }
+    SECTION("dictionary encoding") {
+        const char* words[] = {"actor", "actress", "director", "writer", "producer"};
+        vector<vector<PlanImport::Data>> data;
+        for (int i = 0; i < 20000; i++)
+            data.push_back({i, (i % 7 == 0) ? PlanImport::Data{std::monostate{}} : PlanImport::Data{string(words[i % 5])}});
+        auto tbl = PlanImport::makeTable(data, {DataType::INT32, DataType::VARCHAR});
+        auto file = (std::filesystem::temp_directory_path() / "dictionary.cache.db").string();
+        {
+            DataSource db;
+            db.relations.push_back(tbl->table);
+            std::move(db).serialize(file);
+        }
+        auto db = DataSource::deserialize(file);
+        std::filesystem::remove(file);
+        auto& table = db.relations[0];
+        REQUIRE(!table.columns[0].isDictionaryEncoded());
+        REQUIRE(table.columns[1].dictionary.size() == 5);
+        REQUIRE(StringPtr(table.columns[1].dictionary[0]).materialize_string() == "actor");
+        auto tblInfo = TableScan::makeTableInfo(table);
+
+        auto scanRows = [&](SmallVec<TableScan::RestrictionInfo> restrictions) {
+            TableScan scan(tblInfo, {0, 1}, restrictions, 1, 1);
+            struct LS {
+                TableScan::LocalState scan;
+
+                LS(TableScan& scan) : scan(scan) {}
+            };
+            vector<LS> ls;
+            ls.reserve(scan.concurrency());
+            for (unsigned i = 0; i < scan.concurrency(); i++)
+                ls.emplace_back(scan);
+            std::mutex mutex;
+            set<pair<uint64_t, string>> rows;
+            scan([&](size_t workerId) { return &ls[workerId]; }, [&](auto, auto&& provider) {
+                std::unique_lock lock(mutex);
+                auto value = provider(1);
+                rows.emplace(provider(0), value == TableScan::nullValue ? "<null>" : StringPtr(value).materialize_string()); }, [](auto, auto) {}, [](auto, auto, auto) {});
+            return rows;
+        };
+        auto expected = [&](auto predicate) {
+            set<pair<uint64_t, string>> rows;
+            for (size_t i = 0; i < data.size(); i++) {
+                auto* str = std::get_if<string>(&data[i][1]);
+                if (predicate(str))
+                    rows.emplace(i, str ? *str : "<null>");
+            }
+            return rows;
+        };
+
+        REQUIRE(scanRows({}) == expected([](auto*) { return true; }));
+        for (auto& pattern : {"act%", "%r%", "writer"}) {
+            Restriction restriction{Restriction::Like, {}};
+            restriction.pattern = pattern;
+            auto logic = StringRestrictionLogic::setupRestriction(restriction);
+            REQUIRE(scanRows({{1, 0.5, nullptr, logic.get()}}) == expected([&](auto* str) { return str && Comparison::like_match(*str, pattern); }));
+        }
+    }
+    SECTION("bit packing") {
+        for (unsigned width = 0; width <= 32; width++) {
+            uint32_t base = width < 32 ? 1000 : 0;
+            vector<uint32_t> values;
+            for (uint32_t i = 0; i < BitPacking::blockSize; i++)
+                values.push_back(base + static_cast<uint32_t>(((i * 2654435761ull) >> 7) & ((1ull << width) - 1)));
+            vector<uint8_t> packed(BitPacking::packedSize(width, values.size()) + BitPacking::padding);
+            BitPacking::pack(packed.data(), values.data(), width, base, values.size());
+            vector<uint32_t> unpacked(values.size());
+            BitPacking::unpack(unpacked.data(), packed.data(), width, base, values.size());
+            REQUIRE(unpacked == values);
+        }
+
+        vector<vector<PlanImport::Data>> data;
+        for (int i = 0; i < 50000; i++)
+            data.push_back({i, (i % 9 == 0) ? PlanImport::Data{std::monostate{}} : PlanImport::Data{1000000 + (i * 37) % 1000}});
+        auto tbl = PlanImport::makeTable(data, {DataType::INT32, DataType::INT32});
+        auto file = (std::filesystem::temp_directory_path() / "bitpacking.cache.db").string();
+        {
+            DataSource db;
+            db.relations.push_back(tbl->table);
+            std::move(db).serialize(file);
+        }
+        auto db = DataSource::deserialize(file);
+        std::filesystem::remove(file);
+        auto& table = db.relations[0];
+        REQUIRE(table.columns[0].bitPacked);
+        REQUIRE(table.columns[1].bitPacked);
+        REQUIRE(table.columns[1].pages.size() < tbl->table.columns[1].pages.size());
+        auto tblInfo = TableScan::makeTableInfo(table);
+
+        auto scanRows = [&](SmallVec<TableScan::RestrictionInfo> restrictions) {
+            TableScan scan(tblInfo, {0, 1}, restrictions, 1, 1);
+            struct LS {
+                TableScan::LocalState scan;
+
+                LS(TableScan& scan) : scan(scan) {}
+            };
+            vector<LS> ls;
+            ls.reserve(scan.concurrency());
+            for (unsigned i = 0; i < scan.concurrency(); i++)
+                ls.emplace_back(scan);
+            std::mutex mutex;
+            set<pair<uint64_t, uint64_t>> rows;
+            scan([&](size_t workerId) { return &ls[workerId]; }, [&](auto, auto&& provider) {
+                std::unique_lock lock(mutex);
+                rows.emplace(provider(0), provider(1)); }, [](auto, auto) {}, [](auto, auto, auto) {});
+            return rows;
+        };
+        auto expected = [&](auto predicate) {
+            set<pair<uint64_t, uint64_t>> rows;
+            for (size_t i = 0; i < data.size(); i++) {
+                auto* value = std::get_if<int32_t>(&data[i][1]);
+                if (predicate(i, value))
+                    rows.emplace(i, value ? *value : TableScan::nullValue);
+            }
+            return rows;
+        };
+
+        REQUIRE(scanRows({}) == expected([](size_t, auto*) { return true; }));
+        Restriction range{Restriction::Range, RuntimeValue::from(DataType::INT32, 1000100)};
+        range.upper = 1000199;
+        auto rangeLogic = RestrictionLogic::setupRestriction(range);
+        REQUIRE(scanRows({{1, 0.1, rangeLogic.get()}}) == expected([](size_t, auto* value) { return value && *value >= 1000100 && *value <= 1000199; }));
+        Restriction eq{Restriction::Eq, RuntimeValue::from(DataType::INT32, 31337)};
+        auto eqLogic = RestrictionLogic::setupRestriction(eq);
+        REQUIRE(scanRows({{0, 0.1, eqLogic.get()}, {1, 0.9, RestrictionLogic::notNullRestriction}}) == expected([](size_t i, auto* value) { return value && i == 31337; }));
+    }
     // Vector with many values
     /*SECTION("many values") {
         vector<vector<PlanImport::Data>> data{
@@ -426,6 +1079,83 @@ TEST_CASE("TableScan") {
     }*/
 }
 
+TEST_CASE("IntegerFilters") {
+    constexpr int64_t minValue = std::numeric_limits<int32_t>::min(), maxValue = std::numeric_limits<int32_t>::max();
+    SECTION("signed ranges") {
+        // x = 5, x < 10, x > 10, and x BETWEEN 10 AND 20
+        vector<pair<int64_t, int64_t>> ranges{{5, 5}, {minValue, 9}, {11, maxValue}, {10, 20}};
+        for (auto [lower, upper] : ranges) {
+            auto restriction = Restriction::int32Range(lower, upper);
+            REQUIRE(restriction);
+            REQUIRE(restriction->type == Restriction::Range);
+            for (int64_t value : {minValue, int64_t{-1}, int64_t{0}, int64_t{5}, int64_t{9}, int64_t{10}, int64_t{11}, int64_t{20}, int64_t{21}, maxValue})
+                REQUIRE((*restriction)(static_cast<uint32_t>(value)) == (lower <= value && value <= upper));
+            REQUIRE(!(*restriction)(RuntimeValue::nullValue));
+        }
+        // Negative values are large when compared unsigned, ranges within them stay contiguous
+        auto negative = Restriction::int32Range(minValue, -1);
+        REQUIRE(negative);
+        REQUIRE(negative->cst.value == 0x80000000u);
+        REQUIRE(negative->upper == 0xffffffffu);
+        // Ranges spanning the sign are not contiguous and stay residual
+        REQUIRE(!Restriction::int32Range(-5, 5));
+        REQUIRE(!Restriction::int32Range(minValue, 0));
+        // The whole domain only excludes nulls
+        REQUIRE(Restriction::int32Range(minValue, maxValue)->type == Restriction::NotNull);
+        // Contradicting comparisons and values outside of the domain match nothing
+        for (auto [lower, upper] : vector<pair<int64_t, int64_t>>{{10, 9}, {maxValue + 1, maxValue}, {minValue, minValue - 1}}) {
+            auto empty = Restriction::int32Range(lower, upper);
+            REQUIRE(empty);
+            REQUIRE(empty->type == Restriction::Range);
+            REQUIRE(empty->cst.value > empty->upper);
+        }
+    }
+    SECTION("restriction logics") {
+        // Ranges map to the cheapest comparison
+        auto logicName = [](uint64_t lower, uint64_t upper) {
+            Restriction restriction{Restriction::Range, RuntimeValue::from(DataType::INT32, lower)};
+            restriction.upper = upper;
+            auto logic = RestrictionLogic::setupRestriction(restriction);
+            return logic ? string(logic->name()) : string();
+        };
+        REQUIRE(logicName(5, 5).find("EQRestriction") != string::npos);
+        REQUIRE(logicName(0, 9).find("LtRestriction") != string::npos);
+        REQUIRE(logicName(11, 0xffffffffu).find("GtRestriction") != string::npos);
+        REQUIRE(logicName(10, 20).find("BetweenRestriction") != string::npos);
+        REQUIRE(logicName(0, 0xffffffffu).empty());
+    }
+    SECTION("query plans") {
+        // Both join attributes are in one equivalence class, so the filters on them are intersected
+        auto* context = Contest::build_context();
+        vector<vector<PlanImport::Data>> left, right;
+        for (int i = 0; i < 1000; i++) {
+            left.push_back({i});
+            right.push_back({i});
+        }
+        auto leftTable = PlanImport::makeTable(left, {DataType::INT32});
+        auto rightTable = PlanImport::makeTable(right, {DataType::INT32});
+        DataSource db;
+        db.relations.push_back(leftTable->table);
+        db.relations.push_back(rightTable->table);
+        auto run = [&](int64_t leftLower, int64_t leftUpper, int64_t rightLower, int64_t rightUpper) {
+            Plan plan;
+            plan.new_scan_node(0, {{0, DataType::INT32}});
+            plan.new_scan_node(1, {{0, DataType::INT32}});
+            plan.new_join_node(true, 0, 1, 0, 0, {{0, DataType::INT32}});
+            plan.root = 2;
+            PlanImport::ScanFilter filters[] = {{0, 0, *Restriction::int32Range(leftLower, leftUpper)}, {1, 0, *Restriction::int32Range(rightLower, rightUpper)}};
+            return engine::execute(PlanImport::importPlanExistingData(db, plan, {filters, 2}), context).num_rows;
+        };
+        REQUIRE(run(100, maxValue, minValue, 199) == 100);
+        REQUIRE(run(100, 500, 400, 900) == 101);
+        REQUIRE(run(0, maxValue, 5, 5) == 1);
+        // Contradicting ranges on the equivalence class, the result is empty
+        REQUIRE(run(300, maxValue, minValue, 199) == 0);
+        REQUIRE(run(10, 9, 0, maxValue) == 0);
+        Contest::destroy_context(context);
+    }
+}
+
 TEST_CASE("TableTarget") {
     ContextWrapper context{};
 
@@ -511,6 +1241,48 @@ TEST_CASE("TableTarget") {
             REQUIRE(std::holds_alternative<std::monostate>(data[1][0]));
             REQUIRE(std::holds_alternative<std::monostate>(data[1][1]));
         }
+        SECTION("sink") {
+            constexpr size_t num = 3 * TableTarget::chunkRows;
+            size_t numChunks = 0;
+            size_t numRows = 0;
+            uint64_t sum = 0;
+            auto sink = [&](ColumnarTable& chunk) {
+                numChunks++;
+                numRows += chunk.num_rows;
+                const auto data = Table::from_columnar(chunk).table();
+                REQUIRE(data.size() == chunk.num_rows);
+                for (const auto& elem : data) {
+                    REQUIRE(std::get<T>(elem[1]) == 42);
+                    sum += std::get<T>(elem[0]);
+                }
+            };
+            tt.setSink(sink, {0u, RuntimeValue::from(DataType::INT32, 42)});
+            for (unsigned i = 0; i < num; i++) tt(ls, 1, i);
+            tt.finalize(ls);
+            tt.finishConsume();
+            REQUIRE(numChunks >= 3);
+            REQUIRE(numRows == num);
+            REQUIRE(sum == uint64_t(num) * (num - 1) / 2);
+        }
+        SECTION("pass through") {
+            for (unsigned i = 0; i < 10'000; i++) tt(ls, 1, i);
+            tt.finalize(ls);
+            tt.finishConsume();
+            const auto source = tt.extract();
+            auto& sourcePages = source.columns.front().pages;
+            SmallVec<TableTarget::SourceColumn> sources;
+            sources.push_back({DataType::INT32, {reinterpret_cast<DataSource::Page* const*>(sourcePages.data()), sourcePages.size()}});
+            const auto table = TableTarget::passThrough(sources, source.num_rows, {0u, RuntimeValue::from(DataType::INT32, 42)});
+            REQUIRE(table.columns.front().pages.size() == sourcePages.size());
+            REQUIRE(table.columns.front().pages.front() != sourcePages.front());
+            const auto data = Table::from_columnar(table).table();
+            REQUIRE(data.size() == 10'000);
+            unsigned i = 0;
+            for (const auto& elem : data) {
+                REQUIRE(std::get<T>(elem[0]) == i++);
+                REQUIRE(std::get<T>(elem[1]) == 42);
+            }
+        }
         tt.localStates.clear();
     }
     SECTION("i64/fp64") {
@@ -724,3 +1496,381 @@ TEST_CASE("TableTarget") {
         tt.localStates.clear();
     }
 }
+
+TEST_CASE("CSVLoader") {
+    // The loader runs as its own query
+    void* context = Contest::build_context();
+
+    vector<Attribute> attributes{{DataType::INT32, "id"}, {DataType::INT64, "big"}, {DataType::FP64, "value"}, {DataType::VARCHAR, "name"}};
+    string csv = "id,big,value,name\n";
+    for (int i = 0; i < 20000; i++) {
+        csv += to_string(i) + "," + ((i % 7 == 0) ? "" : to_string(i * 1000003ll)) + "," + ((i % 5 == 0) ? "" : to_string(i / 8.0)) + ",";
+        // Quoted separators, newlines, and escapes must not split records, long strings span pages
+        switch (i % 6) {
+            case 0: break;
+            case 1: csv += "\"a,b " + to_string(i) + "\""; break;
+            case 2: csv += "\"line\nbreak\""; break;
+            case 3: csv += "\"say \\\"hi\\\" \\\\\""; break;
+            case 4: csv += string(i % 24 == 4 ? 20000 : 10, 'x'); break;
+            case 5: csv += "plain"; break;
+        }
+        csv += (i % 3 == 0) ? "\r\n" : "\n";
+    }
+    auto file = (std::filesystem::temp_directory_path() / "csvloader.csv").string();
+    {
+        std::ofstream out(file, std::ios::binary);
+        out << csv;
+    }
+
+    auto starts = CSVLoader::splitChunks(csv, '\\', 4096);
+    REQUIRE(starts.size() > 1);
+    for (auto start : starts)
+        REQUIRE((start == 0 || csv[start - 1] == '\n'));
+
+    auto sorted = [](const ColumnarTable& table) {
+        auto data = Table::from_columnar(table).table();
+        std::sort(data.begin(), data.end());
+        return data;
+    };
+    auto expected = sorted(Table::from_csv(attributes, file, nullptr, true));
+    REQUIRE(expected.size() == 20000);
+    REQUIRE(sorted(CSVLoader::load(attributes, file, nullptr, true, '\\', ',', 4096)) == expected);
+
+    Comparison filter(0, Comparison::LT, int64_t{5000});
+    auto filtered = sorted(CSVLoader::load(attributes, file, &filter, true, '\\', ',', 4096));
+    REQUIRE(filtered == sorted(Table::from_csv(attributes, file, &filter, true)));
+    REQUIRE(filtered.size() == 5000);
+
+    std::filesystem::remove(file);
+    Contest::destroy_context(context);
+}
+//---------------------------------------------------------------------------
+TEST_CASE("ColumnStatistics") {
+    // 10% nulls, 20% sevens and uniformly distributed values with 3500 distinct last digits 2-5 and 7-9
+    ColumnStatistics::Builder builder;
+    for (uint64_t i = 0; i < 100000; i++) {
+        if (i % 10 == 0)
+            builder.addNull();
+        else
+            builder.add((i % 5 == 1) ? 7 : i % 5000);
+    }
+    auto statistics = builder.finish();
+    REQUIRE(statistics.numRows == 100000);
+    REQUIRE(statistics.numNulls == 10000);
+    REQUIRE(statistics.numDistinct > 3300);
+    REQUIRE(statistics.numDistinct < 3700);
+    REQUIRE(statistics.heavyHitters[0] == 7);
+    REQUIRE(statistics.heavyHitterCounts[1] == 0);
+    REQUIRE(std::abs(statistics.estimateEq(7) - 0.2) < 0.02);
+    REQUIRE(statistics.estimateEq(1234) > 0.0001);
+    REQUIRE(statistics.estimateEq(1234) < 0.0004);
+    REQUIRE(statistics.estimateEq(100000) == 0.0);
+    REQUIRE(std::abs(statistics.estimateRange(1000, 2999) - 0.28) < 0.03);
+    REQUIRE(std::abs(statistics.estimateRange(0, 4999) - 0.9) < 0.01);
+    Restriction notNull{Restriction::NotNull, {}};
+    REQUIRE(statistics.estimate(notNull) == 0.9);
+    Restriction like{Restriction::Like, {}};
+    REQUIRE(!statistics.estimate(like));
+
+    SECTION("serialize") {
+        ContextWrapper context{};
+        vector<vector<PlanImport::Data>> data;
+        for (int i = 0; i < 20000; i++)
+            data.push_back({i % 100, (i % 4 == 0) ? PlanImport::Data{std::monostate{}} : PlanImport::Data{double(i) / 8}, "value" + to_string(i % 10)});
+        auto tbl = PlanImport::makeTable(data, {DataType::INT32, DataType::FP64, DataType::VARCHAR});
+        auto file = (std::filesystem::temp_directory_path() / "statistics.cache.db").string();
+        {
+            DataSource db;
+            db.relations.push_back(tbl->table);
+            std::move(db).serialize(file);
+        }
+        auto db = DataSource::deserialize(file);
+        std::filesystem::remove(file);
+        auto& columns = db.relations[0].columns;
+        for (auto& column : columns) {
+            REQUIRE(column.statistics.has_value());
+            REQUIRE(column.statistics->numRows == 20000);
+        }
+        REQUIRE(columns[0].statistics->numDistinct > 95);
+        REQUIRE(columns[0].statistics->numDistinct < 105);
+        REQUIRE(columns[1].statistics->numNulls == 5000);
+        REQUIRE(std::abs(columns[1].statistics->estimateRange(Restriction::doubleKey(0.0), Restriction::doubleKey(1249.875)) - 0.375) < 0.03);
+        // The dictionary encoded strings are described by their codes
+        REQUIRE(columns[2].isDictionaryEncoded());
+        REQUIRE(columns[2].statistics->numDistinct == 10);
+    }
+}
+
+TEST_CASE("CostModel") {
+    CostModel model;
+    for (size_t i = 0; i < CostModel::numSizeClasses; i++)
+        model.probe[i] = i + 1;
+    REQUIRE(model.probeCost(0) == 1);
+    REQUIRE(model.probeCost(1000) == 1);
+    REQUIRE(model.probeCost(4096) == 2);
+    REQUIRE(model.probeCost(1 << 20) == 6);
+    REQUIRE(model.probeCost(1e12) == CostModel::numSizeClasses);
+
+    SECTION("calibrate") {
+        ContextWrapper context{};
+        auto calibrated = CostModel::calibrate();
+        REQUIRE(calibrated.tupleNanos > 0);
+        REQUIRE(calibrated.build > 0);
+        for (double probe : calibrated.probe)
+            REQUIRE(std::isfinite(probe));
+
+        auto file = (std::filesystem::temp_directory_path() / "costmodel").string();
+        calibrated.store(file);
+        CostModel loaded;
+        REQUIRE(loaded.load(file));
+        std::filesystem::remove(file);
+        REQUIRE(loaded.build == calibrated.build);
+        REQUIRE(loaded.probe == calibrated.probe);
+        REQUIRE(!loaded.load(file));
+    }
+}
+
+TEST_CASE("QueryGraph") {
+    ContextWrapper context{};
+    // The query graph only uses the query plan for the number of inputs, all of them scan the same dummy table
+    DataSource db;
+    db.relations.push_back({1000, {}, "dummy"});
+    auto makePlan = [&](unsigned n) {
+        QueryPlan qp(db);
+        for (unsigned i = 0; i < n; i++)
+            qp.addInput(db.relations[0], {});
+        return qp;
+    };
+    // Every edge is joined on an equivalence class of its own
+    auto makeInputs = [](unsigned n, const vector<pair<unsigned, unsigned>>& edges) {
+        SmallVec<QueryGraph::Input> inputs;
+        for (unsigned i = 0; i < n; i++)
+            inputs.push_back({{}, 100.0 * ((i * 7) % 13 + 1)});
+        for (unsigned e = 0; e < edges.size(); e++) {
+            inputs[edges[e].first].producedEq.insert(e);
+            inputs[edges[e].second].producedEq.insert(e);
+        }
+        return inputs;
+    };
+    auto chain = [](unsigned n, unsigned skip = ~0u) {
+        vector<pair<unsigned, unsigned>> edges;
+        for (unsigned i = 0; i + 1 < n; i++)
+            if (i != skip)
+                edges.emplace_back(i, i + 1);
+        return edges;
+    };
+
+    SECTION("greedy") {
+        // Larger graphs than the exact enumeration supports are ordered greedily and only store the plans of the joined sets
+        vector<pair<unsigned, unsigned>> star;
+        for (unsigned i = 1; i < 20; i++)
+            star.emplace_back(0, i);
+        for (auto [n, edges] : {pair{24u, chain(24)}, pair{20u, star}}) {
+            REQUIRE(n > QueryGraph::maxExactInputs);
+            auto qp = makePlan(n);
+            QueryGraph qg(qp, makeInputs(n, edges));
+            auto* root = qg.optimize();
+            REQUIRE(root->set == BitSet::prefix(n));
+            REQUIRE(root->cost < numeric_limits<double>::infinity());
+            REQUIRE(root->card > 0);
+            REQUIRE(!root->isLeaf());
+            REQUIRE(qg.plans.size() == 2 * n - 1);
+        }
+    }
+
+    SECTION("greedy cross product") {
+        // Two chains without a join between them, the greedy ordering leaves both components to the cross product handling
+        constexpr unsigned n = 20;
+        auto qp = makePlan(n);
+        QueryGraph qg(qp, makeInputs(n, chain(n, 9)));
+        auto* root = qg.optimize();
+        REQUIRE(root->set == BitSet::prefix(n));
+        REQUIRE(root->cost < numeric_limits<double>::infinity());
+        REQUIRE(root->left->set + root->right->set == BitSet::prefix(n));
+        REQUIRE((root->left->set == BitSet::prefix(10) || root->right->set == BitSet::prefix(10)));
+        REQUIRE(qg.connected(BitSet::prefix(10)));
+        REQUIRE(qg.connected(BitSet::prefix(n) - BitSet::prefix(10)));
+    }
+
+    SECTION("parallel enumeration") {
+        // The parallel enumeration finds the same plans as the sequential one, also for a hash table that can only be joined on its key
+        auto cyclic = chain(11);
+        cyclic.emplace_back(0, 5);
+        cyclic.emplace_back(2, 7);
+        unsigned keyEq = cyclic.size();
+        cyclic.emplace_back(3, 11);
+        cyclic.emplace_back(8, 11);
+        auto withHashTable = makeInputs(12, cyclic);
+        withHashTable[11].joinKey = keyEq;
+        withHashTable[11].multiplicity = 2.0;
+        vector<pair<unsigned, unsigned>> star;
+        for (unsigned i = 1; i < 14; i++)
+            star.emplace_back(0, i);
+        for (auto& inputs : {withHashTable, makeInputs(14, star)}) {
+            unsigned n = inputs.size();
+            REQUIRE(n >= QueryGraph::minParallelInputs);
+            REQUIRE(n <= QueryGraph::maxExactInputs);
+            auto qp = makePlan(n);
+            QueryGraph parallel(qp, inputs), sequential(qp, inputs);
+            parallel.setupBaseRelations();
+            REQUIRE(parallel.enumerateParallel());
+            sequential.setupBaseRelations();
+            DPccp::enumerateCsgCmp(sequential, [&](BitSet left, BitSet right) {
+                sequential.considerPair(sequential.getPlans(left + right), left, right);
+            });
+            auto full = BitSet::prefix(n);
+            REQUIRE(parallel.connected(full));
+            REQUIRE(sequential.connected(full));
+            for (size_t p = 0; p < QueryGraph::maxPipelineLength; p++) {
+                REQUIRE(parallel.get(full, p).card == sequential.get(full, p).card);
+                REQUIRE(parallel.get(full, p).cost == sequential.get(full, p).cost);
+            }
+            if (inputs[n - 1].joinKey != ~0u) {
+                // The hash table is only joined with the relation that provides its key
+                REQUIRE(!parallel.connected(BitSet{8, 11}));
+                REQUIRE(!sequential.connected(BitSet{8, 11}));
+                REQUIRE(parallel.connected(BitSet{3, 11}));
+            }
+        }
+    }
+}
+
+TEST_CASE("PlanCache") {
+    // The same query shape runs on different data. Later runs may replay the cached pipelines but must produce their own results
+    auto* context = Contest::build_context();
+    constexpr int numRows = 1000;
+    for (int run = 0; run < 3; run++) {
+        Plan plan;
+        plan.new_scan_node(0, {{0, DataType::INT32}});
+        plan.new_scan_node(1, {{0, DataType::INT32}});
+        plan.new_scan_node(2, {{0, DataType::INT32}});
+        plan.new_join_node(true, 0, 1, 0, 0, {{0, DataType::INT32}});
+        plan.new_join_node(false, 3, 2, 0, 0, {{0, DataType::INT32}});
+        plan.root = 4;
+        // Every key of the second table occurs run + 1 times
+        vector<vector<Data>> unique, repeated, half;
+        for (int i = 0; i < numRows; i++) {
+            unique.push_back({i});
+            repeated.push_back({i % (numRows / (run + 1))});
+            if (i < numRows / 2)
+                half.push_back({i});
+        }
+        plan.inputs.emplace_back(Table(std::move(unique), {DataType::INT32}).to_columnar());
+        plan.inputs.emplace_back(Table(std::move(repeated), {DataType::INT32}).to_columnar());
+        plan.inputs.emplace_back(Table(std::move(half), {DataType::INT32}).to_columnar());
+        auto result = Contest::execute(plan, context);
+        REQUIRE(result.num_rows == size_t(std::min(numRows / 2, numRows / (run + 1)) * (run + 1)));
+    }
+    Contest::destroy_context(context);
+}
+
+TEST_CASE("ConcurrentPipelines") {
+    // A star join, the hash tables of the small dimensions are built concurrently
+    auto* context = Contest::build_context();
+    constexpr int numRows = 100000;
+    for (bool emptyResult : {false, true}) {
+        Plan plan;
+        plan.new_scan_node(0, {{0, DataType::INT32}, {1, DataType::INT32}});
+        plan.new_scan_node(1, {{0, DataType::INT32}});
+        plan.new_scan_node(2, {{0, DataType::INT32}});
+        plan.new_join_node(false, 0, 1, 0, 0, {{0, DataType::INT32}, {1, DataType::INT32}});
+        plan.new_join_node(false, 3, 2, 1, 0, {{0, DataType::INT32}});
+        plan.root = 4;
+        vector<vector<Data>> fact, first, second;
+        for (int i = 0; i < numRows; i++)
+            fact.push_back({i % 1000, i % 500});
+        for (int i = 0; i < 100; i++)
+            first.push_back({i});
+        // Without a match in the second dimension, the empty hash table ends the query
+        for (int i = 0; i < 250; i++)
+            second.push_back({emptyResult ? 1000 + i : 2 * i});
+        plan.inputs.emplace_back(Table(std::move(fact), {DataType::INT32, DataType::INT32}).to_columnar());
+        plan.inputs.emplace_back(Table(std::move(first), {DataType::INT32}).to_columnar());
+        plan.inputs.emplace_back(Table(std::move(second), {DataType::INT32}).to_columnar());
+        auto result = Contest::execute(plan, context);
+        REQUIRE(result.num_rows == (emptyResult ? 0 : numRows / 1000 * 50));
+    }
+    Contest::destroy_context(context);
+}
+
+TEST_CASE("SharedBuilds") {
+    // The queries of a batch build the same hash table on the filtered dimension, except for the last one with another filter
+    auto* context = Contest::build_context();
+    vector<vector<PlanImport::Data>> dimension, fact;
+    for (int i = 0; i < 1000; i++)
+        dimension.push_back({i});
+    for (int i = 0; i < 100000; i++)
+        fact.push_back({i % 2000, i % 7});
+    auto dimensionTable = PlanImport::makeTable(dimension, {DataType::INT32});
+    auto factTable = PlanImport::makeTable(fact, {DataType::INT32, DataType::INT32});
+    DataSource db;
+    db.relations.push_back(dimensionTable->table);
+    db.relations.push_back(factTable->table);
+
+    auto makePlan = [&](unsigned outputAttr, uint64_t upper) {
+        Plan plan;
+        plan.new_scan_node(0, {{0, DataType::INT32}});
+        plan.new_scan_node(1, {{0, DataType::INT32}, {1, DataType::INT32}});
+        plan.new_join_node(true, 0, 1, 0, 0, {{outputAttr, DataType::INT32}});
+        plan.root = 2;
+        Restriction range{Restriction::Range, RuntimeValue::from(DataType::INT32, 0)};
+        range.upper = upper;
+        PlanImport::ScanFilter filter{0, 0, range, {}, {}};
+        return PlanImport::importPlanExistingData(db, plan, {&filter, 1});
+    };
+    vector<QueryPlan> plans;
+    plans.push_back(makePlan(0, 499));
+    plans.push_back(makePlan(2, 499));
+    plans.push_back(makePlan(2, 99));
+    auto results = engine::execute(std::move(plans), context);
+    REQUIRE(results.size() == 3);
+    REQUIRE(results[0].num_rows == 25000);
+    REQUIRE(results[1].num_rows == 25000);
+    REQUIRE(results[2].num_rows == 5000);
+    // The shared hash table produces the same result as a hash table of its own
+    auto single = engine::execute(makePlan(2, 499), context);
+    auto sorted = [](const ColumnarTable& table) {
+        auto rows = Table::from_columnar(table).table();
+        std::sort(rows.begin(), rows.end());
+        return rows;
+    };
+    REQUIRE(sorted(results[1]) == sorted(single));
+    Contest::destroy_context(context);
+}
+
+TEST_CASE("SuspendedBuild") {
+    // The build requests the suspension after a few tuples, the resumed scan collects the remaining ones
+    ContextWrapper context{};
+    constexpr int numRows = 100000;
+    vector<vector<PlanImport::Data>> data;
+    for (int i = 0; i < numRows; i++)
+        data.push_back({i});
+    auto tbl = PlanImport::makeTable(data, {DataType::INT32});
+    auto tblInfo = TableScan::makeTableInfo(tbl->table);
+    TableScan scan(tblInfo, {0}, {}, 1, 1);
+    Hashtable ht;
+    HashtableBuild build(ht, numRows);
+    TableScan::Suspension suspension;
+    build.suspendLimit = 1000;
+    build.suspendRequest = &suspension.requested;
+    scan.suspension = &suspension;
+    auto run = [&] {
+        JoinPipeline<HashtableBuild, TableScan, std::tuple<>, std::index_sequence<>, std::index_sequence<0>> pipeline(build, scan, {}, {}, {0});
+        pipeline();
+    };
+
+    run();
+    REQUIRE(suspension.requested.load());
+    // The running morsels are completed, all others are left for resuming
+    REQUIRE(build.getNumTuples() >= 1000);
+    REQUIRE(build.getNumTuples() <= numRows);
+
+    suspension.requested = false;
+    suspension.resuming = true;
+    build.suspendLimit = ~0ull;
+    run();
+    REQUIRE(suspension.remainingMorsels.empty());
+    REQUIRE(ht.getNumTuples() == numRows);
+    for (int i = 0; i < numRows; i += 997)
+        REQUIRE(ht.joinFilterPrecise(i));
+}
@@ -1,7 +1,12 @@
 #include "tools/JoinPipelineLoader.hpp"
 #include "tools/ParsedSQL.hpp"
+#include "query/CSVLoader.hpp"
 #include "query/PlanImport.hpp"
 #include "query/QueryPlan.hpp"
+#include <algorithm>
+#include <climits>
+#include <map>
+#include <optional>
 #include <table.h>
 #pragma GCC push_options
 #pragma GCC optimize("O3")
@@ -13,18 +18,246 @@ namespace fs = std::filesystem;
 //---------------------------------------------------------------------------
 namespace engine {
 //---------------------------------------------------------------------------
-static std::unordered_set<std::string_view> other_operators{"Aggregate", "Gather"};
+static std::unordered_set<std::string_view> other_operators{"Aggregate", "Gather", "Unique"};
 static std::unordered_set<std::string_view> join_types{"Nested Loop",
                                                 "Hash Join",
                                                 "Merge Join"};
 static std::unordered_set<std::string_view> scan_types{"Seq Scan", "Index Only Scan"};
 //---------------------------------------------------------------------------
+/// The input of a skipped operator. A SELECT DISTINCT is planned as a Unique over a Sort, the query plan eliminates the duplicates itself
+/// and the order does not matter. Any other Sort is not supported
+static const json& skip_operator(const json& node) {
+    auto& input = node["Plans"][0];
+    if (node["Node Type"].get<std::string_view>() == "Unique" and input["Node Type"].get<std::string_view>() == "Sort")
+        return input["Plans"][0];
+    return input;
+}
+//---------------------------------------------------------------------------
+namespace {
+//---------------------------------------------------------------------------
+/// The filters of a table that are not pushed into the scan and are evaluated while loading the table
+struct ResidualFilter final : Statement {
+    std::vector<Statement*> children;
+
+    std::string pretty_print(int indent) const override {
+        // Same format as a conjunction, so existing cached tables are found again
+        std::string result = fmt::format("{:{}}[AND]\n", "", indent);
+        for (auto* child : children)
+            result += child->pretty_print(indent + 2) + "\n";
+        result.pop_back();
+        return result;
+    }
+    bool eval(const std::vector<Data>& record) const override {
+        return std::all_of(children.begin(), children.end(), [&](auto* child) { return child->eval(record); });
+    }
+    std::vector<uint8_t> eval(const std::vector<const InnerColumnBase*>& table) const override {
+        auto result = children.front()->eval(table);
+        for (size_t i = 1; i < children.size(); ++i) {
+            auto other = children[i]->eval(table);
+            for (size_t row = 0; row < result.size(); ++row)
+                result[row] &= other[row];
+        }
+        return result;
+    }
+};
+//---------------------------------------------------------------------------
+void collect_conjuncts(Statement* filter, std::vector<Statement*>& conjuncts) {
+    if (auto* op = dynamic_cast<LogicalOperation*>(filter); op && op->op_type == LogicalOperation::AND) {
+        for (auto& child : op->children)
+            collect_conjuncts(child.get(), conjuncts);
+    } else {
+        conjuncts.push_back(filter);
+    }
+}
+//---------------------------------------------------------------------------
+/// Collect the equality comparisons of an IN-list, i.e., of a disjunction of equality comparisons on the same column
+bool collect_in_list(Statement* filter, std::vector<Comparison*>& comparisons) {
+    if (auto* op = dynamic_cast<LogicalOperation*>(filter); op && op->op_type == LogicalOperation::OR) {
+        for (auto& child : op->children)
+            if (not collect_in_list(child.get(), comparisons))
+                return false;
+        return true;
+    }
+    auto* cmp = dynamic_cast<Comparison*>(filter);
+    if (not cmp or cmp->op != Comparison::EQ or (not comparisons.empty() and comparisons.front()->column != cmp->column))
+        return false;
+    comparisons.push_back(cmp);
+    return true;
+}
+//---------------------------------------------------------------------------
+/// The scan restriction of an IN-list on an integer or string column
+std::optional<std::tuple<unsigned, Restriction, std::string, std::vector<uint64_t>>> in_list_restriction(Statement* filter, const std::vector<Attribute>& attributes) {
+    std::vector<Comparison*> comparisons;
+    if (not dynamic_cast<LogicalOperation*>(filter) or not collect_in_list(filter, comparisons))
+        return std::nullopt;
+    unsigned column = comparisons.front()->column;
+    if (attributes[column].type == DataType::INT32) {
+        // The scan compares the stored values, i.e., unsigned. Values outside of the domain never match
+        std::vector<uint64_t> values;
+        for (auto* cmp : comparisons) {
+            auto* value = std::get_if<int64_t>(&cmp->value);
+            if (not value)
+                return std::nullopt;
+            if (*value >= INT32_MIN and *value <= INT32_MAX)
+                values.push_back(static_cast<uint32_t>(*value));
+        }
+        std::sort(values.begin(), values.end());
+        values.erase(std::unique(values.begin(), values.end()), values.end());
+        return std::tuple{column, Restriction{Restriction::In, RuntimeValue::from(DataType::INT32, 0)}, std::string{}, std::move(values)};
+    }
+    if (attributes[column].type == DataType::VARCHAR) {
+        // The strings are separated by newlines, so they must not contain any
+        std::string list;
+        for (auto* cmp : comparisons) {
+            auto* value = std::get_if<std::string>(&cmp->value);
+            if (not value or value->find('\n') != std::string::npos)
+                return std::nullopt;
+            if (cmp != comparisons.front())
+                list += '\n';
+            list += *value;
+        }
+        return std::tuple{column, Restriction{Restriction::StringIn, RuntimeValue::from(DataType::VARCHAR, 0)}, std::move(list), std::vector<uint64_t>{}};
+    }
+    return std::nullopt;
+}
+//---------------------------------------------------------------------------
+/// The inclusive range of values satisfying a comparison on an integer column
+std::optional<std::pair<int64_t, int64_t>> comparison_range(const Comparison& cmp) {
+    if (cmp.op == Comparison::IS_NOT_NULL)
+        return std::pair<int64_t, int64_t>{INT32_MIN, INT32_MAX};
+    auto* value = std::get_if<int64_t>(&cmp.value);
+    if (not value)
+        return std::nullopt;
+    switch (cmp.op) {
+        case Comparison::EQ: return std::pair<int64_t, int64_t>{*value, *value};
+        case Comparison::LT: return std::pair<int64_t, int64_t>{INT32_MIN, *value - 1};
+        case Comparison::LEQ: return std::pair<int64_t, int64_t>{INT32_MIN, *value};
+        case Comparison::GT: return std::pair<int64_t, int64_t>{*value + 1, INT32_MAX};
+        case Comparison::GEQ: return std::pair<int64_t, int64_t>{*value, INT32_MAX};
+        default: return std::nullopt;
+    }
+}
+//---------------------------------------------------------------------------
+/// The inclusive range of keys, see Restriction::doubleKey, of the values satisfying a comparison on a double column.
+/// The keys order NaN after all other values and -0.0 like 0.0, as SQL does. An empty range has first > second
+std::optional<std::pair<uint64_t, uint64_t>> double_comparison_range(const Comparison& cmp) {
+    constexpr uint64_t minKey = 0, maxKey = ~0ull;
+    if (cmp.op == Comparison::IS_NOT_NULL)
+        return std::pair<uint64_t, uint64_t>{minKey, maxKey};
+    std::optional<double> value;
+    if (auto* d = std::get_if<double>(&cmp.value))
+        value = *d;
+    else if (auto* i = std::get_if<int64_t>(&cmp.value))
+        value = static_cast<double>(*i);
+    if (not value)
+        return std::nullopt;
+    // The keys of doubles are contiguous, so the neighbors of a key exclude the value itself
+    auto key = Restriction::doubleKey(*value);
+    switch (cmp.op) {
+        case Comparison::EQ: return std::pair<uint64_t, uint64_t>{key, key};
+        case Comparison::LT: return key == minKey ? std::pair<uint64_t, uint64_t>{maxKey, minKey} : std::pair<uint64_t, uint64_t>{minKey, key - 1};
+        case Comparison::LEQ: return std::pair<uint64_t, uint64_t>{minKey, key};
+        case Comparison::GT: return key == maxKey ? std::pair<uint64_t, uint64_t>{maxKey, minKey} : std::pair<uint64_t, uint64_t>{key + 1, maxKey};
+        case Comparison::GEQ: return std::pair<uint64_t, uint64_t>{key, maxKey};
+        default: return std::nullopt;
+    }
+}
+//---------------------------------------------------------------------------
+/// The restriction type of a comparison on a string column
+std::optional<Restriction::Type> string_restriction_type(const Comparison& cmp) {
+    auto* value = std::get_if<std::string>(&cmp.value);
+    // The scan does not support patterns with newlines
+    if (not value or value->find('\n') != std::string::npos)
+        return std::nullopt;
+    switch (cmp.op) {
+        case Comparison::EQ: return Restriction::StringEq;
+        case Comparison::NEQ: return Restriction::StringNeq;
+        case Comparison::LIKE: return Restriction::Like;
+        case Comparison::NOT_LIKE: return Restriction::NotLike;
+        default: return std::nullopt;
+    }
+}
+//---------------------------------------------------------------------------
+/// Split a filter into restrictions on integer, double, and string columns, including IN-lists, for the scan and the residual filter.
+/// Returns the filter that still has to be evaluated while loading the table.
+Statement* split_filter(Statement* filter, const std::vector<Attribute>& attributes, ResidualFilter& residual, std::vector<std::tuple<unsigned, Restriction, std::string, std::vector<uint64_t>>>& restrictions) {
+    std::vector<Statement*> conjuncts;
+    collect_conjuncts(filter, conjuncts);
+
+    // The range per column and the conjuncts it was built from
+    std::map<size_t, std::tuple<int64_t, int64_t, std::vector<Statement*>>> ranges;
+    // The key range per double column, such ranges are always contiguous
+    std::map<size_t, std::pair<uint64_t, uint64_t>> double_ranges;
+    for (auto* conjunct : conjuncts) {
+        if (auto restriction = in_list_restriction(conjunct, attributes)) {
+            restrictions.push_back(std::move(*restriction));
+            continue;
+        }
+        auto* cmp = dynamic_cast<Comparison*>(conjunct);
+        if (cmp and attributes[cmp->column].type == DataType::VARCHAR) {
+            if (auto type = string_restriction_type(*cmp)) {
+                restrictions.emplace_back(cmp->column, Restriction{*type, RuntimeValue::from(DataType::VARCHAR, 0)}, std::get<std::string>(cmp->value), std::vector<uint64_t>{});
+                continue;
+            }
+        }
+        if (cmp and attributes[cmp->column].type == DataType::FP64) {
+            if (auto range = double_comparison_range(*cmp)) {
+                auto [itr, _] = double_ranges.try_emplace(cmp->column, 0, ~0ull);
+                itr->second.first = std::max(itr->second.first, range->first);
+                itr->second.second = std::min(itr->second.second, range->second);
+                continue;
+            }
+        }
+        std::optional<std::pair<int64_t, int64_t>> range;
+        if (cmp and attributes[cmp->column].type == DataType::INT32)
+            range = comparison_range(*cmp);
+        if (not range) {
+            residual.children.push_back(conjunct);
+            continue;
+        }
+        auto [itr, _] = ranges.try_emplace(cmp->column, INT32_MIN, INT32_MAX, std::vector<Statement*>{});
+        auto& [lower, upper, sources] = itr->second;
+        lower = std::max(lower, range->first);
+        upper = std::min(upper, range->second);
+        sources.push_back(conjunct);
+    }
+
+    for (auto& [column, entry] : ranges) {
+        auto& [lower, upper, sources] = entry;
+        auto restriction = Restriction::int32Range(lower, upper);
+        if (not restriction) {
+            // Not a contiguous range of unsigned values
+            residual.children.insert(residual.children.end(), sources.begin(), sources.end());
+            continue;
+        }
+        restrictions.emplace_back(column, *restriction, std::string{}, std::vector<uint64_t>{});
+    }
+    for (auto& [column, range] : double_ranges) {
+        // Contradicting ranges stay empty, the query plan recognizes them
+        Restriction restriction{Restriction::DoubleRange, RuntimeValue::from(DataType::FP64, range.first)};
+        restriction.upper = range.second;
+        if (range.first == 0 and range.second == ~0ull)
+            restriction.type = Restriction::NotNull;
+        restrictions.emplace_back(column, restriction, std::string{}, std::vector<uint64_t>{});
+    }
+
+    if (restrictions.empty())
+        return filter;
+    if (residual.children.empty())
+        return nullptr;
+    if (residual.children.size() == 1)
+        return residual.children.front();
+    return &residual;
+}
+//---------------------------------------------------------------------------
+}
+//---------------------------------------------------------------------------
 std::unordered_set<TableEntity> JoinPipelineLoader::extract_entities(const json& node) {
     auto& alias_map = parsed_sql.alias_map;
     auto node_type = node["Node Type"].get<std::string_view>();
 
     if (auto itr = other_operators.find(node_type); itr != other_operators.end()) {
-        return extract_entities(node["Plans"][0]);
+        return extract_entities(skip_operator(node));
     } else if (auto itr = join_types.find(node_type); itr != join_types.end()) {
         if (node_type != "Hash Join") {
             throw std::runtime_error("Not Hash Join");
@@ -72,7 +305,7 @@ std::tuple<size_t, std::vector<std::tuple<TableEntity, std::string, DataType>>>
     auto node_type = node["Node Type"].get<std::string_view>();
 
     if (auto itr = other_operators.find(node_type); itr != other_operators.end()) {
-        return recurse(node["Plans"][0], required_attrs);
+        return recurse(skip_operator(node), required_attrs);
     } else if (auto itr = join_types.find(node_type); itr != join_types.end()) {
         if (node_type != "Hash Join") {
             throw std::runtime_error("Not Hash Join");
@@ -250,13 +483,19 @@ std::tuple<size_t, std::vector<std::tuple<TableEntity, std::string, DataType>>>
         if (auto itr = filters.find(entity); itr != filters.end()) {
             filter = itr->second.get();
         }
+        // Integer and string comparisons are evaluated by the scan on the unfiltered table
+        ResidualFilter residual;
+        std::vector<std::tuple<unsigned, Restriction, std::string, std::vector<uint64_t>>> scan_restrictions;
+        if (filter and pushed_filters) {
+            filter = split_filter(filter, *pattributes, residual, scan_restrictions);
+        }
         std::string lookupName = fmt::format("{}|{}", entity.table, filter ? filter->pretty_print() : std::string{});
 
         lookupName = DataSource::Table::fixName(lookupName);
         auto it = db.tables.find(lookupName);
         if (it == db.tables.end()) {
             fmt::print("Table {} not found in cache, loading it\n", lookupName);
-            auto table = Table::from_csv(*pattributes, fs::path("imdb") / fmt::format("{}.csv", entity.table), filter);
+            auto table = CSVLoader::load(*pattributes, fs::path("imdb") / fmt::format("{}.csv", entity.table), filter);
             db.columns.push_back(std::move(table));
             auto imported = PlanImport::importTable(db.columns.back());
             imported.name = lookupName;
@@ -289,14 +528,17 @@ std::tuple<size_t, std::vector<std::tuple<TableEntity, std::string, DataType>>>
             }
         }
         auto new_node_id = ret.new_scan_node(new_input_id, std::move(output_attrs));
+        for (auto& [column, restriction, pattern, values] : scan_restrictions) {
+            pushed_filters->push_back({static_cast<unsigned>(new_node_id), column, restriction, std::move(pattern), std::move(values)});
+        }
         return {new_node_id, std::move(output_columns)};
     } else {
         throw std::runtime_error(fmt::format("Not supported node type: {}", node_type));
     }
 }
 //---------------------------------------------------------------------------
-::Plan JoinPipelineLoader::load_join_pipeline(DataSourceBuilder& dbb, const json& node, const ParsedSQL& parsed_sql) {
-    JoinPipelineLoader loader{parsed_sql, dbb};
+::Plan JoinPipelineLoader::load_join_pipeline(DataSourceBuilder& dbb, const json& node, const ParsedSQL& parsed_sql, std::vector<PlanImport::ScanFilter>* pushed_filters) {
+    JoinPipelineLoader loader{parsed_sql, dbb, {}, pushed_filters};
     std::tie(loader.ret.root, std::ignore) = loader.recurse(node, parsed_sql.output_attrs);
     return std::move(loader.ret);
 }
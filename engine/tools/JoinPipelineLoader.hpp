@@ -1,5 +1,6 @@
 #pragma once
 //---------------------------------------------------------------------------
+#include "query/PlanImport.hpp"
 #include <nlohmann/json_fwd.hpp>
 #include <plan.h>
 #include <table_entity.h>
@@ -22,11 +23,14 @@ struct JoinPipelineLoader {
     const ParsedSQL& parsed_sql;
     DataSourceBuilder& db;
     ::Plan ret;
+    /// The filters evaluated by the table scans, if pushing down is enabled
+    std::vector<PlanImport::ScanFilter>* pushed_filters = nullptr;
 
     std::unordered_set<TableEntity> extract_entities(const nlohmann::json& node);
     std::tuple<size_t, std::vector<std::tuple<TableEntity, std::string, DataType>>> recurse(const nlohmann::json& node, const OutputAttrsType& required_attrs);
 
-    static ::Plan load_join_pipeline(DataSourceBuilder& db, const nlohmann::json& node, const ParsedSQL& parsed_sql);
+    /// Load the plan. Integer and string comparisons are pushed into the scans if pushed_filters is given, the rest is applied while loading the tables
+    static ::Plan load_join_pipeline(DataSourceBuilder& db, const nlohmann::json& node, const ParsedSQL& parsed_sql, std::vector<PlanImport::ScanFilter>* pushed_filters = nullptr);
 };
 //---------------------------------------------------------------------------
 }
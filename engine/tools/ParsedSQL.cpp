@@ -678,7 +678,7 @@ std::string ParsedSQL::executed_sql(const std::string& sql) {
     std::string_view other = std::string_view{sql.data() + from_clause_begin,
                                               sql.size() - num_trailing_space - from_clause_begin};
 
-    return fmt::format("SELECT {} {}", select_list, other);
+    return fmt::format("SELECT {}{} {}", distinct ? "DISTINCT " : "", select_list, other);
 }
 //---------------------------------------------------------------------------
 void ParsedSQL::parse_sql(const std::string& sql, std::string_view name) {
@@ -689,6 +689,7 @@ void ParsedSQL::parse_sql(const std::string& sql, std::string_view name) {
         throw std::runtime_error(fmt::format("Error parsing SQL: {}", name));
     }
     auto statement = (const hsql::SelectStatement*) sql_result.getStatement(0);
+    distinct = statement->selectDistinct;
 
     size_t column_count = 0;
     auto handleTable = [&](hsql::TableRef* table) {
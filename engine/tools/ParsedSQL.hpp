@@ -25,6 +25,8 @@ struct ParsedSQL {
     JoinGraphType join_graph;
     FilterMapType filters;
     OutputAttrsType output_attrs;
+    /// Is this a SELECT DISTINCT
+    bool distinct = false;
     ColumnMapType column_map;
     std::vector<std::tuple<TableEntity, std::string>> column_vec;
 
@@ -1,6 +1,7 @@
 #include "Execute.hpp"
 #include "infra/Scheduler.hpp"
 #include "op/TableScan.hpp"
+#include "query/CostModel.hpp"
 #include "query/PlanImport.hpp"
 #include "storage/StringPtr.hpp"
 #include "table.h"
@@ -19,6 +20,9 @@ static engine::Setting repeats("REPEAT", engine::setting::Size(10));
 static engine::Setting diff_count("DIFF.count_to_print", engine::setting::Size(20));
 static engine::Setting fastCompare("FASTCOMP", engine::setting::Bool(false));
 static engine::Setting checkResult("CHECKRESULT", engine::setting::Bool(true));
+static engine::Setting warmUp("WARMUP", engine::setting::Bool(true));
+static engine::Setting calibrate("CALIBRATE", engine::setting::Bool(false));
+static engine::Setting batch("BATCH", engine::setting::Bool(false));
 //---------------------------------------------------------------------------
 namespace {
 //---------------------------------------------------------------------------
@@ -211,6 +215,35 @@ static std::tuple<bool, size_t, std::string_view> run(engine::DataSource& db, en
     return {compare_result, std::chrono::duration_cast<std::chrono::microseconds>(end - start).count() / rpts, query.name};
 }
 //---------------------------------------------------------------------------
+static std::vector<Result> runBatch(engine::DataSource& db, std::vector<engine::SQL::Query>& queries, [[maybe_unused]] void* context) {
+    fmt::print("\rRunning batch of {} queries", queries.size());
+    fflush(stdout);
+
+    auto rpts = repeats.get();
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<ColumnarTable> results;
+    for (size_t i = 0; i < rpts; i++) {
+        std::vector<QueryPlan> plans;
+        plans.reserve(queries.size());
+        for (auto& query : queries)
+            plans.push_back(query.planMaker->makePlan());
+        results = engine::execute(std::move(plans), context);
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    // The queries share the runtime of the batch evenly
+    auto runtime = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count() / rpts / std::max<size_t>(queries.size(), 1);
+    std::vector<Result> batchResults;
+    for (size_t i = 0; i < queries.size(); i++) {
+        fmt::print("\rChecking query: {}         ", queries[i].name);
+        fflush(stdout);
+        auto compare_result = checkResult.get() && compare(db.relations[queries[i].resultRelation], results[i]);
+        batchResults.emplace_back(compare_result, runtime, queries[i].name);
+    }
+    return batchResults;
+}
+//---------------------------------------------------------------------------
 int main(int argc, char* argv[]) {
     const auto output_filename = std::string{"BENCHMARK_RUNTIME.txt"};
     const auto record_filename = std::string{"record.csv"};
@@ -234,6 +267,17 @@ int main(int argc, char* argv[]) {
         const auto end_context = std::chrono::steady_clock::now();
         runtime += std::chrono::duration_cast<std::chrono::microseconds>(end_context - start_context).count();
 
+        // Measure the costs of the operators on this machine, the next runs use them
+        if (calibrate.get()) {
+            auto model = engine::CostModel::calibrate();
+            model.store(engine::CostModel::defaultFile);
+            engine::CostModel::set(model);
+            fmt::print("Calibrated cost model: {:.2f} ns per tuple, build {:.2f}, probe", model.tupleNanos, model.build);
+            for (double probe : model.probe)
+                fmt::print(" {:.2f}", probe);
+            fmt::print("\n");
+        }
+
         // load plan json
 
         auto write_output_file = false, write_record_file = false;
@@ -254,8 +298,17 @@ int main(int argc, char* argv[]) {
         bool all_queries_succeeded = true;
 
         std::vector<Result> results;
-        for (engine::SQL::Query& query : queries.queries)
-            results.push_back(run(*queries.db, query, context));
+        if (batch.get()) {
+            // All queries run as one batch that shares the hash tables built from base tables
+            results = runBatch(*queries.db, queries.queries, context);
+        } else {
+            for (size_t i = 0; i < queries.queries.size(); i++) {
+                // The kernel reads the columns of the next query in the background while this one runs
+                if (warmUp.get() && i + 1 < queries.queries.size())
+                    queries.queries[i + 1].planMaker->warmUp();
+                results.push_back(run(*queries.db, queries.queries[i], context));
+            }
+        }
         fmt::print("\n");
 
         std::sort(results.begin(), results.end(), [](auto& a, auto& b) { return std::get<1>(a) < std::get<1>(b); });
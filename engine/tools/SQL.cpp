@@ -68,8 +68,9 @@ SQL::Batch SQL::parse(const std::string& planFile, std::vector<std::string> sele
             auto executed = parsed_sql.executed_sql(sql);
 
             Plan plan;
+            std::vector<PlanImport::ScanFilter> scanFilters;
             try {
-                plan = JoinPipelineLoader::load_join_pipeline(dbb, plan_json["Plan"], parsed_sql);
+                plan = JoinPipelineLoader::load_join_pipeline(dbb, plan_json["Plan"], parsed_sql, &scanFilters);
             } catch (const std::exception& e) {
                 fmt::print("SKIPPING: Could not load plan for query {} with reason: {}\n", name, e.what());
                 continue;
@@ -95,12 +96,17 @@ SQL::Batch SQL::parse(const std::string& planFile, std::vector<std::string> sele
             struct Info final : public PlanMaker {
                 DataSource* db = nullptr;
                 Plan plan;
-                Info(DataSource* db, Plan plan) : db(db), plan(std::move(plan)) {}
+                std::vector<PlanImport::ScanFilter> scanFilters;
+                bool distinct;
+                Info(DataSource* db, Plan plan, std::vector<PlanImport::ScanFilter> scanFilters, bool distinct) : db(db), plan(std::move(plan)), scanFilters(std::move(scanFilters)), distinct(distinct) {}
                 QueryPlan makePlan() override {
-                    return PlanImport::importPlanExistingData(*db, plan);
+                    return PlanImport::importPlanExistingData(*db, plan, scanFilters, distinct);
+                }
+                void warmUp() override {
+                    PlanImport::warmUp(*db, plan, scanFilters);
                 }
             };
-            std::unique_ptr<PlanMaker> info = std::make_unique<Info>(batch.db.get(), std::move(plan));
+            std::unique_ptr<PlanMaker> info = std::make_unique<Info>(batch.db.get(), std::move(plan), std::move(scanFilters), parsed_sql.distinct);
             batch.queries.push_back(Query{name, executed, std::move(info), dbb.tables.at(resultName)});
         }
     }
@@ -15,6 +15,8 @@ class SQL {
     struct PlanMaker {
         virtual ~PlanMaker() noexcept = default;
         virtual QueryPlan makePlan() = 0;
+        /// Hint that the data of the query will be read soon
+        virtual void warmUp() {}
     };
     /// The parse result
     struct Query {